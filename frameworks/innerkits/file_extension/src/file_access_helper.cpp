@@ -28,19 +28,19 @@ constexpr int INVALID_VALUE = -1;
 FileAccessHelper::FileAccessHelper(const std::shared_ptr<OHOS::AbilityRuntime::Context> &context,
     const AAFwk::Want &want, const sptr<IFileExtBase> &fileExtProxy)
 {
-    HILOG_INFO("tag dsa FileAccessHelper::FileAccessHelper start");
+    HILOG_DEBUG("tag dsa FileAccessHelper::FileAccessHelper start");
     token_ = context->GetToken();
     want_ = want;
     fileExtProxy_ = fileExtProxy;
     fileExtConnection_ = FileExtConnection::GetInstance();
-    HILOG_INFO("tag dsa FileAccessHelper::FileAccessHelper end");
+    HILOG_DEBUG("tag dsa FileAccessHelper::FileAccessHelper end");
 }
 
 void FileAccessHelper::AddFileAccessDeathRecipient(const sptr<IRemoteObject> &token)
 {
-    HILOG_INFO("tag dsa %{public}s called begin", __func__);
+    HILOG_DEBUG("tag dsa %{public}s called begin", __func__);
     if (token != nullptr && callerDeathRecipient_ != nullptr) {
-        HILOG_INFO("tag dsa token RemoveDeathRecipient.");
+        HILOG_DEBUG("tag dsa token RemoveDeathRecipient.");
         token->RemoveDeathRecipient(callerDeathRecipient_);
     }
     if (callerDeathRecipient_ == nullptr) {
@@ -48,31 +48,31 @@ void FileAccessHelper::AddFileAccessDeathRecipient(const sptr<IRemoteObject> &to
             new FileAccessDeathRecipient(std::bind(&FileAccessHelper::OnSchedulerDied, this, std::placeholders::_1));
     }
     if (token != nullptr) {
-        HILOG_INFO("tag dsa token AddDeathRecipient.");
+        HILOG_DEBUG("tag dsa token AddDeathRecipient.");
         token->AddDeathRecipient(callerDeathRecipient_);
     }
-    HILOG_INFO("tag dsa %{public}s called end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s called end", __func__);
 }
 
 void FileAccessHelper::OnSchedulerDied(const wptr<IRemoteObject> &remote)
 {
-    HILOG_INFO("tag dsa %{public}s called begin", __func__);
+    HILOG_DEBUG("tag dsa %{public}s called begin", __func__);
     auto object = remote.promote();
     object = nullptr;
     fileExtProxy_ = nullptr;
-    HILOG_INFO("tag dsa %{public}s called end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s called end", __func__);
 }
 
 std::shared_ptr<FileAccessHelper> FileAccessHelper::Creator(
     const std::shared_ptr<OHOS::AbilityRuntime::Context> &context, const AAFwk::Want &want)
 {
-    HILOG_INFO("tag dsa FileAccessHelper::Creator with runtime context, want and uri called start.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Creator with runtime context, want and uri called start.");
     if (context == nullptr) {
         HILOG_ERROR("tag dsa ileAccessHelper::Creator failed, context == nullptr");
         return nullptr;
     }
 
-    HILOG_INFO("tag dsa FileAccessHelper::Creator before ConnectFileExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Creator before ConnectFileExtAbility.");
     sptr<IFileExtBase> fileExtProxy = nullptr;
 
     sptr<FileExtConnection> fileExtConnection = FileExtConnection::GetInstance();
@@ -83,7 +83,7 @@ std::shared_ptr<FileAccessHelper> FileAccessHelper::Creator(
     if (fileExtProxy == nullptr) {
         HILOG_WARN("tag dsa FileAccessHelper::Creator get invalid fileExtProxy");
     }
-    HILOG_INFO("tag dsa FileAccessHelper::Creator after ConnectFileExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Creator after ConnectFileExtAbility.");
 
     FileAccessHelper *ptrDataShareHelper = new (std::nothrow) FileAccessHelper(context, want, fileExtProxy);
     if (ptrDataShareHelper == nullptr) {
@@ -91,35 +91,35 @@ std::shared_ptr<FileAccessHelper> FileAccessHelper::Creator(
         return nullptr;
     }
 
-    HILOG_INFO("tag dsa FileAccessHelper::Creator with runtime context, want and uri called end.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Creator with runtime context, want and uri called end.");
     return std::shared_ptr<FileAccessHelper>(ptrDataShareHelper);
 }
 
 bool FileAccessHelper::Release()
 {
-    HILOG_INFO("tag dsa %{public}s called begin", __func__);
+    HILOG_DEBUG("tag dsa %{public}s called begin", __func__);
 
-    HILOG_INFO("tag dsa FileAccessHelper::Release before DisconnectFileExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Release before DisconnectFileExtAbility.");
     if (fileExtConnection_->IsExtAbilityConnected()) {
         fileExtConnection_->DisconnectFileExtAbility();
     }
-    HILOG_INFO("tag dsa FileAccessHelper::Release after DisconnectFileExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Release after DisconnectFileExtAbility.");
     fileExtProxy_ = nullptr;
-    HILOG_INFO("tag dsa %{public}s called end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s called end", __func__);
     return true;
 }
 
 int FileAccessHelper::OpenFile(Uri &uri, const std::string &mode)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int fd = INVALID_VALUE;
 
-    HILOG_INFO("tag dsa FileAccessHelper::OpenFile before ConnectFileExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::OpenFile before ConnectFileExtAbility.");
     if (!fileExtConnection_->IsExtAbilityConnected()) {
         fileExtConnection_->ConnectFileExtAbility(want_, token_);
     }
     fileExtProxy_ = fileExtConnection_->GetFileExtProxy();
-    HILOG_INFO("tag dsa FileAccessHelper::OpenFile after ConnectFileExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::OpenFile after ConnectFileExtAbility.");
     if (isSystemCaller_ && fileExtProxy_) {
         AddFileAccessDeathRecipient(fileExtProxy_->AsObject());
     }
@@ -129,23 +129,23 @@ int FileAccessHelper::OpenFile(Uri &uri, const std::string &mode)
         return fd;
     }
 
-    HILOG_INFO("tag dsa FileAccessHelper::OpenFile before fileExtProxy_->OpenFile.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::OpenFile before fileExtProxy_->OpenFile.");
     fd = fileExtProxy_->OpenFile(uri, mode);
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     return fd;
 }
 
 int FileAccessHelper::CreateFile(Uri &parentUri, const std::string &displayName, Uri &newFileUri)
 {
-    HILOG_INFO("tag dsa FileAccessHelper::CreateFile start.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::CreateFile start.");
     int index = INVALID_VALUE;
 
-    HILOG_INFO("tag dsa FileAccessHelper::CreateFile before ConnectDataShareExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::CreateFile before ConnectDataShareExtAbility.");
     if (!fileExtConnection_->IsExtAbilityConnected()) {
         fileExtConnection_->ConnectFileExtAbility(want_, token_);
     }
     fileExtProxy_ = fileExtConnection_->GetFileExtProxy();
-    HILOG_INFO("tag dsa FileAccessHelper::CreateFile after ConnectDataShareExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::CreateFile after ConnectDataShareExtAbility.");
     if (isSystemCaller_ && fileExtProxy_) {
         AddFileAccessDeathRecipient(fileExtProxy_->AsObject());
     }
@@ -155,24 +155,24 @@ int FileAccessHelper::CreateFile(Uri &parentUri, const std::string &displayName,
         return index;
     }
 
-    HILOG_INFO("tag dsa FileAccessHelper::CreateFile before fileExtProxy_->CreateFile.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::CreateFile before fileExtProxy_->CreateFile.");
     index = fileExtProxy_->CreateFile(parentUri, displayName, newFileUri);
-    HILOG_INFO("tag dsa FileAccessHelper::CreateFile end. index = %{public}d", index);
-    HILOG_INFO("tag dsa FileAccessHelper::CreateFile end. newDirUri = %{public}s", newFileUri.ToString().c_str());
+    HILOG_DEBUG("tag dsa FileAccessHelper::CreateFile end. index = %{public}d", index);
+    HILOG_DEBUG("tag dsa FileAccessHelper::CreateFile end. newDirUri = %{public}s", newFileUri.ToString().c_str());
     return index;
 }
 
 int FileAccessHelper::Mkdir(Uri &parentUri, const std::string &displayName, Uri &newDirUri)
 {
-    HILOG_INFO("tag dsa FileAccessHelper::Mkdir start.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Mkdir start.");
     int index = INVALID_VALUE;
 
-    HILOG_INFO("tag dsa FileAccessHelper::Mkdir before ConnectDataShareExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Mkdir before ConnectDataShareExtAbility.");
     if (!fileExtConnection_->IsExtAbilityConnected()) {
         fileExtConnection_->ConnectFileExtAbility(want_, token_);
     }
     fileExtProxy_ = fileExtConnection_->GetFileExtProxy();
-    HILOG_INFO("tag dsa FileAccessHelper::Mkdir after ConnectDataShareExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Mkdir after ConnectDataShareExtAbility.");
     if (isSystemCaller_ && fileExtProxy_) {
         AddFileAccessDeathRecipient(fileExtProxy_->AsObject());
     }
@@ -182,24 +182,24 @@ int FileAccessHelper::Mkdir(Uri &parentUri, const std::string &displayName, Uri
         return index;
     }
 
-    HILOG_INFO("tag dsa FileAccessHelper::Mkdir before fileExtProxy_->Mkdir.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Mkdir before fileExtProxy_->Mkdir.");
     index = fileExtProxy_->Mkdir(parentUri, displayName, newDirUri);
-    HILOG_INFO("tag dsa FileAccessHelper::Mkdir end. index = %{public}d", index);
-    HILOG_INFO("tag dsa FileAccessHelper::Mkdir end. newDirUri = %{public}s", newDirUri.ToString().c_str());
+    HILOG_DEBUG("tag dsa FileAccessHelper::Mkdir end. index = %{public}d", index);
+    HILOG_DEBUG("tag dsa FileAccessHelper::Mkdir end. newDirUri = %{public}s", newDirUri.ToString().c_str());
     return index;
 }
 
 int FileAccessHelper::Delete(Uri &selectFileUri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int index = INVALID_VALUE;
 
-    HILOG_INFO("tag dsa FileAccessHelper::Delete before ConnectFileExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Delete before ConnectFileExtAbility.");
     if (!fileExtConnection_->IsExtAbilityConnected()) {
         fileExtConnection_->ConnectFileExtAbility(want_, token_);
     }
     fileExtProxy_ = fileExtConnection_->GetFileExtProxy();
-    HILOG_INFO("tag dsa FileAccessHelper::Delete after ConnectFileExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Delete after ConnectFileExtAbility.");
     if (isSystemCaller_ && fileExtProxy_) {
         AddFileAccessDeathRecipient(fileExtProxy_->AsObject());
     }
@@ -209,23 +209,23 @@ int FileAccessHelper::Delete(Uri &selectFileUri)
         return index;
     }
 
-    HILOG_INFO("tag dsa FileAccessHelper::Delete before fileExtProxy_->Delete.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Delete before fileExtProxy_->Delete.");
     index = fileExtProxy_->Delete(selectFileUri);
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     return index;
 }
 
 int FileAccessHelper::Move(Uri &sourceFileUri, Uri &targetParentUri, Uri &newFileUri)
 {
-    HILOG_INFO("tag dsa FileAccessHelper::Move start.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Move start.");
     int index = INVALID_VALUE;
 
-    HILOG_INFO("tag dsa FileAccessHelper::Move before ConnectDataShareExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Move before ConnectDataShareExtAbility.");
     if (!fileExtConnection_->IsExtAbilityConnected()) {
         fileExtConnection_->ConnectFileExtAbility(want_, token_);
     }
     fileExtProxy_ = fileExtConnection_->GetFileExtProxy();
-    HILOG_INFO("tag dsa FileAccessHelper::Move after ConnectDataShareExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Move after ConnectDataShareExtAbility.");
     if (isSystemCaller_ && fileExtProxy_) {
         AddFileAccessDeathRecipient(fileExtProxy_->AsObject());
     }
@@ -235,24 +235,24 @@ int FileAccessHelper::Move(Uri &sourceFileUri, Uri &targetParentUri, Uri &newFil
         return index;
     }
 
-    HILOG_INFO("tag dsa FileAccessHelper::Move before fileExtProxy_->Move.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Move before fileExtProxy_->Move.");
     index = fileExtProxy_->Move(sourceFileUri, targetParentUri, newFileUri);
-    HILOG_INFO("tag dsa FileAccessHelper::Move end. index = %{public}d", index);
-    HILOG_INFO("tag dsa FileAccessHelper::Move end. newFileUri = %{public}s", newFileUri.ToString().c_str());
+    HILOG_DEBUG("tag dsa FileAccessHelper::Move end. index = %{public}d", index);
+    HILOG_DEBUG("tag dsa FileAccessHelper::Move end. newFileUri = %{public}s", newFileUri.ToString().c_str());
     return index;
 }
 
 int FileAccessHelper::Rename(Uri &sourceFileUri, const std::string &displayName, Uri &newFileUri)
 {
-    HILOG_INFO("tag dsa FileAccessHelper::Rename start.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Rename start.");
     int index = INVALID_VALUE;
 
-    HILOG_INFO("tag dsa FileAccessHelper::Rename before ConnectDataShareExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Rename before ConnectDataShareExtAbility.");
     if (!fileExtConnection_->IsExtAbilityConnected()) {
         fileExtConnection_->ConnectFileExtAbility(want_, token_);
     }
     fileExtProxy_ = fileExtConnection_->GetFileExtProxy();
-    HILOG_INFO("tag dsa FileAccessHelper::Rename after ConnectDataShareExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Rename after ConnectDataShareExtAbility.");
     if (isSystemCaller_ && fileExtProxy_) {
         AddFileAccessDeathRecipient(fileExtProxy_->AsObject());
     }
@@ -262,24 +262,24 @@ int FileAccessHelper::Rename(Uri &sourceFileUri, const std::string &displayName,
         return index;
     }
 
-    HILOG_INFO("tag dsa FileAccessHelper::Rename before fileExtProxy_->Rename.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::Rename before fileExtProxy_->Rename.");
     index = fileExtProxy_->Rename(sourceFileUri, displayName, newFileUri);
-    HILOG_INFO("tag dsa FileAccessHelper::Rename end. index = %{public}d", index);
-    HILOG_INFO("tag dsa FileAccessHelper::Rename end. newFileUri = %{public}s", newFileUri.ToString().c_str());
+    HILOG_DEBUG("tag dsa FileAccessHelper::Rename end. index = %{public}d", index);
+    HILOG_DEBUG("tag dsa FileAccessHelper::Rename end. newFileUri = %{public}s", newFileUri.ToString().c_str());
     return index;
 }
 
 int FileAccessHelper::CloseFile(int fd, const std::string &uri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int index = INVALID_VALUE;
 
-    HILOG_INFO("tag dsa FileAccessHelper::CloseFile before ConnectFileExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::CloseFile before ConnectFileExtAbility.");
     if (!fileExtConnection_->IsExtAbilityConnected()) {
         fileExtConnection_->ConnectFileExtAbility(want_, token_);
     }
     fileExtProxy_ = fileExtConnection_->GetFileExtProxy();
-    HILOG_INFO("tag dsa FileAccessHelper::CloseFile after ConnectFileExtAbility.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::CloseFile after ConnectFileExtAbility.");
     if (isSystemCaller_ && fileExtProxy_) {
         AddFileAccessDeathRecipient(fileExtProxy_->AsObject());
     }
@@ -289,29 +289,29 @@ int FileAccessHelper::CloseFile(int fd, const std::string &uri)
         return index;
     }
 
-    HILOG_INFO("tag dsa FileAccessHelper::CloseFile before fileExtProxy_->CloseFile.");
+    HILOG_DEBUG("tag dsa FileAccessHelper::CloseFile before fileExtProxy_->CloseFile.");
     index = fileExtProxy_->CloseFile(fd, uri);
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     return index;
 }
 
 void FileAccessDeathRecipient::OnRemoteDied(const wptr<IRemoteObject> &remote)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     if (handler_) {
         handler_(remote);
     }
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
 }
 
 FileAccessDeathRecipient::FileAccessDeathRecipient(RemoteDiedHandler handler) : handler_(handler)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
 }
 
 FileAccessDeathRecipient::~FileAccessDeathRecipient()
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
 }
 }  // namespace AppExecFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -21,7 +21,7 @@ namespace OHOS {
 namespace AppExecFwk {
 int FileExtProxy::OpenFile(const Uri &uri, const std::string &mode)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int fd = -1;
     MessageParcel data;
     if (!data.WriteInterfaceToken(FileExtProxy::GetDescriptor())) {
@@ -53,13 +53,13 @@ int FileExtProxy::OpenFile(const Uri &uri, const std::string &mode)
         return fd;
     }
 
-    HILOG_INFO("tag dsa %{public}s end successfully, return fd=%{public}d", __func__, fd);
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return fd=%{public}d", __func__, fd);
     return fd;
 }
 
 int FileExtProxy::CloseFile(int fd, const std::string &uri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int ret = -1;
     MessageParcel data;
     if (!data.WriteInterfaceToken(FileExtProxy::GetDescriptor())) {
@@ -91,13 +91,13 @@ int FileExtProxy::CloseFile(int fd, const std::string &uri)
         return ret;
     }
 
-    HILOG_INFO("tag dsa %{public}s end successfully, return ret=%{public}d", __func__, ret);
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return ret=%{public}d", __func__, ret);
     return ret;
 }
 
 int FileExtProxy::CreateFile(const Uri &parentUri, const std::string &displayName,  Uri &newFileUri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int ret = -1;
     MessageParcel data;
     if (!data.WriteInterfaceToken(FileExtProxy::GetDescriptor())) {
@@ -141,16 +141,16 @@ int FileExtProxy::CreateFile(const Uri &parentUri, const std::string &displayNam
         return ret;
     }
 
-    HILOG_INFO("tag dsa %{public}s end successfully, return ret=%{public}d, newFileUri=%{public}s", __func__, ret, newFileUri.ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return ret=%{public}d, newFileUri=%{public}s", __func__, ret, newFileUri.ToString().c_str());
     newFileUri = Uri(*tempUri);
-    HILOG_INFO("tag dsa %{public}s end successfully, return ret=%{public}d, newFileUri=%{public}s", __func__, ret, newFileUri.ToString().c_str());
-    HILOG_INFO("tag dsa %{public}s end successfully, tempUri=%{public}s", __func__, tempUri->ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return ret=%{public}d, newFileUri=%{public}s", __func__, ret, newFileUri.ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end successfully, tempUri=%{public}s", __func__, tempUri->ToString().c_str());
     return ret;
 }
 
 int FileExtProxy::Mkdir(const Uri &parentUri, const std::string &displayName, Uri &newFileUri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int ret = -1;
     MessageParcel data;
     if (!data.WriteInterfaceToken(FileExtProxy::GetDescriptor())) {
@@ -194,16 +194,16 @@ int FileExtProxy::Mkdir(const Uri &parentUri, const std::string &displayName, Ur
         return ret;
     }
 
-    HILOG_INFO("tag dsa %{public}s end successfully, return ret=%{public}d, newFileUri=%{public}s", __func__, ret, newFileUri.ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return ret=%{public}d, newFileUri=%{public}s", __func__, ret, newFileUri.ToString().c_str());
     newFileUri = Uri(*tempUri);
-    HILOG_INFO("tag dsa %{public}s end successfully, return ret=%{public}d, newFileUri=%{public}s", __func__, ret, newFileUri.ToString().c_str());
-    HILOG_INFO("tag dsa %{public}s end successfully, tempUri=%{public}s", __func__, tempUri->ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return ret=%{public}d, newFileUri=%{public}s", __func__, ret, newFileUri.ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end successfully, tempUri=%{public}s", __func__, tempUri->ToString().c_str());
     return ret;
 }
 
 int FileExtProxy::Delete(const Uri &sourceFileUri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int ret = -1;
     MessageParcel data;
     if (!data.WriteInterfaceToken(FileExtProxy::GetDescriptor())) {
@@ -230,13 +230,13 @@ int FileExtProxy::Delete(const Uri &sourceFileUri)
         return ret;
     }
 
-    HILOG_INFO("tag dsa %{public}s end successfully, return ret=%{public}d", __func__, ret);
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return ret=%{public}d", __func__, ret);
     return ret;
 }
 
 int FileExtProxy::Move(const Uri &sourceFileUri, const Uri &targetParentUri, Uri &newFileUri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int ret = -1;
     MessageParcel data;
     if (!data.WriteInterfaceToken(FileExtProxy::GetDescriptor())) {
@@ -280,16 +280,16 @@ int FileExtProxy::Move(const Uri &sourceFileUri, const Uri &targetParentUri, Uri
         return ret;
     }
 
-    HILOG_INFO("tag dsa %{public}s end successfully, return ret=%{public}d, newFileUri=%{public}s", __func__, ret, newFileUri.ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return ret=%{public}d, newFileUri=%{public}s", __func__, ret, newFileUri.ToString().c_str());
     newFileUri = Uri(*tempUri);
-    HILOG_INFO("tag dsa %{public}s end successfully, return ret=%{public}d, newFileUri=%{public}s", __func__, ret, newFileUri.ToString().c_str());
-    HILOG_INFO("tag dsa %{public}s end successfully, tempUri=%{public}s", __func__, tempUri->ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return ret=%{public}d, newFileUri=%{public}s", __func__, ret, newFileUri.ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end successfully, tempUri=%{public}s", __func__, tempUri->ToString().c_str());
     return ret;
 }
 
 int FileExtProxy::Rename(const Uri &sourceFileUri, const std::string &displayName, Uri &newFileUri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int ret = -1;
     MessageParcel data;
     if (!data.WriteInterfaceToken(FileExtProxy::GetDescriptor())) {
@@ -333,10 +333,10 @@ int FileExtProxy::Rename(const Uri &sourceFileUri, const std::string &displayNam
         return ret;
     }
 
-    HILOG_INFO("tag dsa %{public}s end successfully, return ret=%{public}d, newFileUri=%{public}s", __func__, ret, newFileUri.ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return ret=%{public}d, newFileUri=%{public}s", __func__, ret, newFileUri.ToString().c_str());
     newFileUri = Uri(*tempUri);
-    HILOG_INFO("tag dsa %{public}s end successfully, return ret=%{public}d, newFileUri=%{public}s", __func__, ret, newFileUri.ToString().c_str());
-    HILOG_INFO("tag dsa %{public}s end successfully, tempUri=%{public}s", __func__, tempUri->ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return ret=%{public}d, newFileUri=%{public}s", __func__, ret, newFileUri.ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end successfully, tempUri=%{public}s", __func__, tempUri->ToString().c_str());
     return ret;
 }
 } // namespace AAFwk
@@ -21,7 +21,7 @@ namespace OHOS {
 namespace AppExecFwk {
 FileExtStub::FileExtStub()
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     stubFuncMap_[CMD_OPEN_FILE] = &FileExtStub::CmdOpenFile;
     stubFuncMap_[CMD_CLOSE_FILE] = &FileExtStub::CmdCloseFile;
     stubFuncMap_[CMD_CREATE_FILE] = &FileExtStub::CmdCreateFile;
@@ -33,18 +33,18 @@ FileExtStub::FileExtStub()
 
 FileExtStub::~FileExtStub()
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     stubFuncMap_.clear();
 }
 
 int FileExtStub::OnRemoteRequest(uint32_t code, MessageParcel& data, MessageParcel& reply,
     MessageOption& option)
 {
-    HILOG_INFO("tag dsa %{public}s Received stub message: %{public}d", __func__, code);
+    HILOG_DEBUG("tag dsa %{public}s Received stub message: %{public}d", __func__, code);
     std::u16string descriptor = FileExtStub::GetDescriptor();
     std::u16string remoteDescriptor = data.ReadInterfaceToken();
     if (descriptor != remoteDescriptor) {
-        HILOG_INFO("tag dsa local descriptor is not equal to remote");
+        HILOG_ERROR("tag dsa local descriptor is not equal to remote");
         return ERR_INVALID_STATE;
     }
 
@@ -53,13 +53,13 @@ int FileExtStub::OnRemoteRequest(uint32_t code, MessageParcel& data, MessageParc
         return (this->*(itFunc->second))(data, reply);
     }
 
-    HILOG_INFO("tag dsa %{public}s remote request unhandled: %{public}d", __func__, code);
+    HILOG_DEBUG("tag dsa %{public}s remote request unhandled: %{public}d", __func__, code);
     return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
 }
 
 ErrCode FileExtStub::CmdOpenFile(MessageParcel &data, MessageParcel &reply)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     std::shared_ptr<Uri> uri(data.ReadParcelable<Uri>());
     if (uri == nullptr) {
         HILOG_ERROR("tag dsa FileExtStub uri is nullptr");
@@ -75,19 +75,19 @@ ErrCode FileExtStub::CmdOpenFile(MessageParcel &data, MessageParcel &reply)
         HILOG_ERROR("tag dsa OpenFile fail, fd is %{pubilc}d", fd);
         return ERR_INVALID_VALUE;
     }
-    HILOG_INFO("tag dsa %{public}s retutn fd: %{public}d.", __func__, fd);
+    HILOG_DEBUG("tag dsa %{public}s retutn fd: %{public}d.", __func__, fd);
 
     if (!reply.WriteFileDescriptor(fd)) {
         HILOG_ERROR("tag dsa fail to WriteFileDescriptor fd");
         return ERR_INVALID_VALUE;
     }
-    HILOG_INFO("tag dsa %{public}s end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s end.", __func__);
     return NO_ERROR;
 }
 
 ErrCode FileExtStub::CmdCloseFile(MessageParcel &data, MessageParcel &reply)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int fd = data.ReadFileDescriptor();
     if (fd < 0) {
         HILOG_ERROR("tag dsa FileExtStub fd is invalid");
@@ -109,13 +109,13 @@ ErrCode FileExtStub::CmdCloseFile(MessageParcel &data, MessageParcel &reply)
         HILOG_ERROR("tag dsa fail to WriteInt32 ret");
         return ERR_INVALID_VALUE;
     }
-    HILOG_INFO("tag dsa %{public}s end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s end.", __func__);
     return NO_ERROR;
 }
 
 ErrCode FileExtStub::CmdCreateFile(MessageParcel &data, MessageParcel &reply)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     std::shared_ptr<Uri> parentUri(data.ReadParcelable<Uri>());
     if (parentUri == nullptr) {
         HILOG_ERROR("tag dsa FileExtStub parentUri is nullptr");
@@ -147,14 +147,14 @@ ErrCode FileExtStub::CmdCreateFile(MessageParcel &data, MessageParcel &reply)
         HILOG_ERROR("fail to WriteParcelable type");
         return ERR_INVALID_VALUE;
     }
-    HILOG_INFO("tag dsa %{public}s end. ret:%d, newFileUri = %{public}s", __func__, ret, newFileUri->ToString().c_str());
-    HILOG_INFO("tag dsa %{public}s end. newFileUri = %{public}s", __func__, newFileUri->ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end. ret:%d, newFileUri = %{public}s", __func__, ret, newFileUri->ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end. newFileUri = %{public}s", __func__, newFileUri->ToString().c_str());
     return NO_ERROR;
 }
 
 ErrCode FileExtStub::CmdMkdir(MessageParcel &data, MessageParcel &reply)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     std::shared_ptr<Uri> parentUri(data.ReadParcelable<Uri>());
     if (parentUri == nullptr) {
         HILOG_ERROR("tag dsa FileExtStub parentUri is nullptr");
@@ -187,14 +187,14 @@ ErrCode FileExtStub::CmdMkdir(MessageParcel &data, MessageParcel &reply)
         return ERR_INVALID_VALUE;
     }
 
-    HILOG_INFO("tag dsa %{public}s end. ret:%d, newFileUri = %{public}s", __func__, ret, newFileUri->ToString().c_str());
-    HILOG_INFO("tag dsa %{public}s end. newFileUri = %{public}s", __func__, newFileUri->ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end. ret:%d, newFileUri = %{public}s", __func__, ret, newFileUri->ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end. newFileUri = %{public}s", __func__, newFileUri->ToString().c_str());
     return NO_ERROR;
 }
 
 ErrCode FileExtStub::CmdDelete(MessageParcel &data, MessageParcel &reply)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     std::shared_ptr<Uri> uri(data.ReadParcelable<Uri>());
     if (uri == nullptr) {
         HILOG_ERROR("tag dsa FileExtStub uri is nullptr");
@@ -211,13 +211,13 @@ ErrCode FileExtStub::CmdDelete(MessageParcel &data, MessageParcel &reply)
         HILOG_ERROR("tag dsa fail to WriteFileDescriptor ret");
         return ERR_INVALID_VALUE;
     }
-    HILOG_INFO("tag dsa %{public}s end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s end.", __func__);
     return NO_ERROR;
 }
 
 ErrCode FileExtStub::CmdMove(MessageParcel &data, MessageParcel &reply)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     std::shared_ptr<Uri> sourceFileUri(data.ReadParcelable<Uri>());
     if (sourceFileUri == nullptr) {
         HILOG_ERROR("tag dsa FileExtStub sourceFileUri is nullptr");
@@ -250,14 +250,14 @@ ErrCode FileExtStub::CmdMove(MessageParcel &data, MessageParcel &reply)
         return ERR_INVALID_VALUE;
     }
 
-    HILOG_INFO("tag dsa %{public}s end. ret:%d, newFileUri = %{public}s", __func__, ret, newFileUri->ToString().c_str());
-    HILOG_INFO("tag dsa %{public}s end. newFileUri = %{public}s", __func__, newFileUri->ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end. ret:%d, newFileUri = %{public}s", __func__, ret, newFileUri->ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end. newFileUri = %{public}s", __func__, newFileUri->ToString().c_str());
     return NO_ERROR;
 }
 
 ErrCode FileExtStub::CmdRename(MessageParcel &data, MessageParcel &reply)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     std::shared_ptr<Uri> sourceFileUri(data.ReadParcelable<Uri>());
     if (sourceFileUri == nullptr) {
         HILOG_ERROR("tag dsa FileExtStub sourceFileUri is nullptr");
@@ -290,8 +290,8 @@ ErrCode FileExtStub::CmdRename(MessageParcel &data, MessageParcel &reply)
         return ERR_INVALID_VALUE;
     }
 
-    HILOG_INFO("tag dsa %{public}s end. ret:%d, newFileUri = %{public}s", __func__, ret, newFileUri->ToString().c_str());
-    HILOG_INFO("tag dsa %{public}s end. newFileUri = %{public}s", __func__, newFileUri->ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end. ret:%d, newFileUri = %{public}s", __func__, ret, newFileUri->ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end. newFileUri = %{public}s", __func__, newFileUri->ToString().c_str());
     return NO_ERROR;
 }
 } // namespace AAFwk
@@ -21,13 +21,13 @@ namespace OHOS {
 namespace AppExecFwk {
 std::shared_ptr<JsFileExtAbility> FileExtStubImpl::GetOwner()
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     return extension_;
 }
 
 int FileExtStubImpl::OpenFile(const Uri &uri, const std::string &mode)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int ret = -1;
     auto extension = GetOwner();
     if (extension == nullptr) {
@@ -35,13 +35,13 @@ int FileExtStubImpl::OpenFile(const Uri &uri, const std::string &mode)
         return ret;
     }
     ret = extension->OpenFile(uri, mode);
-    HILOG_INFO("tag dsa %{public}s end successfully, return fd:%{public}d", __func__, ret);
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return fd:%{public}d", __func__, ret);
     return ret;
 }
 
 int FileExtStubImpl::CloseFile(int fd, const std::string &uri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int ret = -1;
     auto extension = GetOwner();
     if (extension == nullptr) {
@@ -49,13 +49,13 @@ int FileExtStubImpl::CloseFile(int fd, const std::string &uri)
         return ret;
     }
     ret = extension->CloseFile(fd, uri);
-    HILOG_INFO("tag dsa %{public}s end successfully, return fd:%{public}d", __func__, ret);
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return fd:%{public}d", __func__, ret);
     return ret;
 }
 
 int FileExtStubImpl::CreateFile(const Uri &parentUri, const std::string &displayName,  Uri &newFileUri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int ret = -1;
     auto extension = GetOwner();
     if (extension == nullptr) {
@@ -63,13 +63,13 @@ int FileExtStubImpl::CreateFile(const Uri &parentUri, const std::string &display
         return ret;
     }
     ret = extension->CreateFile(parentUri, displayName, newFileUri);
-    HILOG_INFO("tag dsa %{public}s end successfully, return ret:%{public}d, %{public}s", __func__, ret,newFileUri.ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return ret:%{public}d, %{public}s", __func__, ret,newFileUri.ToString().c_str());
     return ret;
 }
 
 int FileExtStubImpl::Mkdir(const Uri &parentUri, const std::string &displayName, Uri &newFileUri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int ret = -1;
     auto extension = GetOwner();
     if (extension == nullptr) {
@@ -77,13 +77,13 @@ int FileExtStubImpl::Mkdir(const Uri &parentUri, const std::string &displayName,
         return ret;
     }
     ret = extension->Mkdir(parentUri, displayName, newFileUri);
-    HILOG_INFO("tag dsa %{public}s end successfully, return ret:%{public}d, %{public}s", __func__, ret,newFileUri.ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return ret:%{public}d, %{public}s", __func__, ret,newFileUri.ToString().c_str());
     return ret;
 }
 
 int FileExtStubImpl::Delete(const Uri &sourceFileUri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int ret = -1;
     auto extension = GetOwner();
     if (extension == nullptr) {
@@ -91,12 +91,12 @@ int FileExtStubImpl::Delete(const Uri &sourceFileUri)
         return ret;
     }
     ret = extension->Delete(sourceFileUri);
-    HILOG_INFO("tag dsa %{public}s end successfully, return fd:%{public}d", __func__, ret);
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return fd:%{public}d", __func__, ret);
     return ret;
 }
 int FileExtStubImpl::Move(const Uri &sourceFileUri, const Uri &targetParentUri, Uri &newFileUri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int ret = -1;
     auto extension = GetOwner();
     if (extension == nullptr) {
@@ -104,12 +104,12 @@ int FileExtStubImpl::Move(const Uri &sourceFileUri, const Uri &targetParentUri,
         return ret;
     }
     ret = extension->Move(sourceFileUri, targetParentUri, newFileUri);
-    HILOG_INFO("tag dsa %{public}s end successfully, return ret:%{public}d, %{public}s", __func__, ret,newFileUri.ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return ret:%{public}d, %{public}s", __func__, ret,newFileUri.ToString().c_str());
     return ret;
 }
 int FileExtStubImpl::Rename(const Uri &sourceFileUri, const std::string &displayName, Uri &newFileUri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     int ret = -1;
     auto extension = GetOwner();
     if (extension == nullptr) {
@@ -117,7 +117,7 @@ int FileExtStubImpl::Rename(const Uri &sourceFileUri, const std::string &display
         return ret;
     }
     ret = extension->Rename(sourceFileUri, displayName, newFileUri);
-    HILOG_INFO("tag dsa %{public}s end successfully, return ret:%{public}d, %{public}s", __func__, ret,newFileUri.ToString().c_str());
+    HILOG_DEBUG("tag dsa %{public}s end successfully, return ret:%{public}d, %{public}s", __func__, ret,newFileUri.ToString().c_str());
     return ret;
 }
 } // namespace AppExecFwk
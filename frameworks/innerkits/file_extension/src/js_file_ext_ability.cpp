@@ -42,7 +42,7 @@ using OHOS::Security::AccessToken::AccessTokenKit;
 
 JsFileExtAbility* JsFileExtAbility::Create(const std::unique_ptr<Runtime>& runtime)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     return new JsFileExtAbility(static_cast<JsRuntime&>(*runtime));
 }
 
@@ -53,7 +53,7 @@ void JsFileExtAbility::Init(const std::shared_ptr<AbilityLocalRecord> &record,
     const std::shared_ptr<OHOSApplication> &application, std::shared_ptr<AbilityHandler> &handler,
     const sptr<IRemoteObject> &token)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     FileExtAbility::Init(record, application, handler, token);
     std::string srcPath = "";
     GetSrcPath(srcPath);
@@ -64,7 +64,7 @@ void JsFileExtAbility::Init(const std::shared_ptr<AbilityLocalRecord> &record,
 
     std::string moduleName(Extension::abilityInfo_->moduleName);
     moduleName.append("::").append(abilityInfo_->name);
-    HILOG_INFO("tag dsa %{public}s module:%{public}s, srcPath:%{public}s.", __func__, moduleName.c_str(), srcPath.c_str());
+    HILOG_DEBUG("tag dsa %{public}s module:%{public}s, srcPath:%{public}s.", __func__, moduleName.c_str(), srcPath.c_str());
     HandleScope handleScope(jsRuntime_);
 
     jsObj_ = jsRuntime_.LoadModule(moduleName, srcPath);
@@ -72,18 +72,18 @@ void JsFileExtAbility::Init(const std::shared_ptr<AbilityLocalRecord> &record,
         HILOG_ERROR("tag dsa Failed to get jsObj_");
         return;
     }
-    HILOG_INFO("tag dsa JsFileExtAbility::Init ConvertNativeValueTo.");
+    HILOG_DEBUG("tag dsa JsFileExtAbility::Init ConvertNativeValueTo.");
     NativeObject* obj = ConvertNativeValueTo<NativeObject>(jsObj_->Get());
     if (obj == nullptr) {
         HILOG_ERROR("tag dsa Failed to get JsFileExtAbility object");
         return;
     }
-    HILOG_INFO("tag dsa JsFileExtAbility::Init end.");
+    HILOG_DEBUG("tag dsa JsFileExtAbility::Init end.");
 }
 
 void JsFileExtAbility::OnStart(const AAFwk::Want &want)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     Extension::OnStart(want);
     HandleScope handleScope(jsRuntime_);
     napi_env env = reinterpret_cast<napi_env>(&jsRuntime_.GetNativeEngine());
@@ -91,13 +91,13 @@ void JsFileExtAbility::OnStart(const AAFwk::Want &want)
     NativeValue* nativeWant = reinterpret_cast<NativeValue*>(napiWant);
     NativeValue* argv[] = {nativeWant};
     CallObjectMethod("onCreate", argv, ARGC_ONE);
-    HILOG_INFO("tag dsa %{public}s end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s end.", __func__);
 }
 
 sptr<IRemoteObject> JsFileExtAbility::OnConnect(const AAFwk::Want &want)
 {
     BYTRACE_NAME(BYTRACE_TAG_DISTRIBUTEDDATA, __PRETTY_FUNCTION__);
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     Extension::OnConnect(want);
     sptr<FileExtStubImpl> remoteObject = new (std::nothrow) FileExtStubImpl(
         std::static_pointer_cast<JsFileExtAbility>(shared_from_this()),
@@ -106,13 +106,13 @@ sptr<IRemoteObject> JsFileExtAbility::OnConnect(const AAFwk::Want &want)
         HILOG_ERROR("tag dsa %{public}s No memory allocated for FileExtStubImpl", __func__);
         return nullptr;
     }
-    HILOG_INFO("tag dsa %{public}s end. ", __func__);
+    HILOG_DEBUG("tag dsa %{public}s end. ", __func__);
     return remoteObject->AsObject();
 }
 
 NativeValue* JsFileExtAbility::CallObjectMethod(const char* name, NativeValue* const* argv, size_t argc)
 {
-    HILOG_INFO("tag dsa JsFileExtAbility::CallObjectMethod(%{public}s), begin", name);
+    HILOG_DEBUG("tag dsa JsFileExtAbility::CallObjectMethod(%{public}s), begin", name);
 
     if (!jsObj_) {
         HILOG_WARN("Not found FileExtAbility.js");
@@ -134,13 +134,13 @@ NativeValue* JsFileExtAbility::CallObjectMethod(const char* name, NativeValue* c
         HILOG_ERROR("tag dsa Failed to get '%{public}s' from FileExtAbility object", name);
         return nullptr;
     }
-    HILOG_INFO("tag dsa JsFileExtAbility::CallFunction(%{public}s), success", name);
+    HILOG_DEBUG("tag dsa JsFileExtAbility::CallFunction(%{public}s), success", name);
     return handleScope.Escape(nativeEngine.CallFunction(value, method, argv, argc));
 }
 
 void JsFileExtAbility::GetSrcPath(std::string &srcPath)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     if (!Extension::abilityInfo_->isStageBasedModel) {
         /* temporary compatibility api8 + config.json */
         srcPath.append(Extension::abilityInfo_->package);
@@ -149,7 +149,7 @@ void JsFileExtAbility::GetSrcPath(std::string &srcPath)
             srcPath.append(Extension::abilityInfo_->srcPath);
         }
         srcPath.append("/").append(Extension::abilityInfo_->name).append(".abc");
-        HILOG_INFO("tag dsa %{public}s end1, srcPath:%{public}s", __func__, srcPath.c_str());
+        HILOG_DEBUG("tag dsa %{public}s end1, srcPath:%{public}s", __func__, srcPath.c_str());
         return;
     }
 
@@ -159,12 +159,12 @@ void JsFileExtAbility::GetSrcPath(std::string &srcPath)
         srcPath.erase(srcPath.rfind('.'));
         srcPath.append(".abc");
     }
-    HILOG_INFO("tag dsa %{public}s end2, srcPath:%{public}s", __func__, srcPath.c_str());
+    HILOG_DEBUG("tag dsa %{public}s end2, srcPath:%{public}s", __func__, srcPath.c_str());
 }
 
 int JsFileExtAbility::OpenFile(const Uri &uri, const std::string &mode)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     HandleScope handleScope(jsRuntime_);
     napi_env env = reinterpret_cast<napi_env>(&jsRuntime_.GetNativeEngine());
 
@@ -183,13 +183,13 @@ int JsFileExtAbility::OpenFile(const Uri &uri, const std::string &mode)
         return ret;
     }
     ret = OHOS::AppExecFwk::UnwrapInt32FromJS(env, reinterpret_cast<napi_value>(nativeResult));
-    HILOG_INFO("tag dsa %{public}s end. return fd:%{public}d", __func__, ret);
+    HILOG_DEBUG("tag dsa %{public}s end. return fd:%{public}d", __func__, ret);
     return ret;
 }
 
 int JsFileExtAbility::CloseFile(int fd, const std::string &uri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     HandleScope handleScope(jsRuntime_);
     napi_env env = reinterpret_cast<napi_env>(&jsRuntime_.GetNativeEngine());
 
@@ -208,13 +208,13 @@ int JsFileExtAbility::CloseFile(int fd, const std::string &uri)
         return ret;
     }
     ret = OHOS::AppExecFwk::UnwrapInt32FromJS(env, reinterpret_cast<napi_value>(nativeResult));
-    HILOG_INFO("tag dsa %{public}s end. return fd:%{public}d", __func__, ret);
+    HILOG_DEBUG("tag dsa %{public}s end. return fd:%{public}d", __func__, ret);
     return ret;
 }
 
 int JsFileExtAbility::CreateFile(const Uri &parentUri, const std::string &displayName,  Uri &newFileUri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     HandleScope handleScope(jsRuntime_);
     napi_env env = reinterpret_cast<napi_env>(&jsRuntime_.GetNativeEngine());
 
@@ -240,13 +240,13 @@ int JsFileExtAbility::CreateFile(const Uri &parentUri, const std::string &displa
         ret = NO_ERROR;
     }
     newFileUri = Uri(uriStr);
-    HILOG_INFO("tag dsa %{public}s end. return fd:%{public}d, newFileUri = %{public}s", __func__, ret, uriStr.c_str());
+    HILOG_DEBUG("tag dsa %{public}s end. return fd:%{public}d, newFileUri = %{public}s", __func__, ret, uriStr.c_str());
     return ret;
 }
 
 int JsFileExtAbility::Mkdir(const Uri &parentUri, const std::string &displayName, Uri &newFileUri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     HandleScope handleScope(jsRuntime_);
     napi_env env = reinterpret_cast<napi_env>(&jsRuntime_.GetNativeEngine());
 
@@ -272,13 +272,13 @@ int JsFileExtAbility::Mkdir(const Uri &parentUri, const std::string &displayName
         ret = NO_ERROR;
     }
     newFileUri = Uri(uriStr);
-    HILOG_INFO("tag dsa %{public}s end. return fd:%{public}d, newFileUri = %{public}s", __func__, ret, uriStr.c_str());
+    HILOG_DEBUG("tag dsa %{public}s end. return fd:%{public}d, newFileUri = %{public}s", __func__, ret, uriStr.c_str());
     return ret;
 }
 
 int JsFileExtAbility::Delete(const Uri &sourceFileUri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     HandleScope handleScope(jsRuntime_);
     napi_env env = reinterpret_cast<napi_env>(&jsRuntime_.GetNativeEngine());
 
@@ -294,13 +294,13 @@ int JsFileExtAbility::Delete(const Uri &sourceFileUri)
         return ret;
     }
     ret = OHOS::AppExecFwk::UnwrapInt32FromJS(env, reinterpret_cast<napi_value>(nativeResult));
-    HILOG_INFO("tag dsa %{public}s end. return fd:%{public}d", __func__, ret);
+    HILOG_DEBUG("tag dsa %{public}s end. return fd:%{public}d", __func__, ret);
     return ret;
 }
 
 int JsFileExtAbility::Move(const Uri &sourceFileUri, const Uri &targetParentUri, Uri &newFileUri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     HandleScope handleScope(jsRuntime_);
     napi_env env = reinterpret_cast<napi_env>(&jsRuntime_.GetNativeEngine());
 
@@ -326,13 +326,13 @@ int JsFileExtAbility::Move(const Uri &sourceFileUri, const Uri &targetParentUri,
         ret = NO_ERROR;
     }
     newFileUri = Uri(uriStr);
-    HILOG_INFO("tag dsa %{public}s end. return fd:%{public}d, newFileUri = %{public}s", __func__, ret, uriStr.c_str());
+    HILOG_DEBUG("tag dsa %{public}s end. return fd:%{public}d, newFileUri = %{public}s", __func__, ret, uriStr.c_str());
     return ret;
 }
 
 int JsFileExtAbility::Rename(const Uri &sourceFileUri, const std::string &displayName, Uri &newFileUri)
 {
-    HILOG_INFO("tag dsa %{public}s begin.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s begin.", __func__);
     HandleScope handleScope(jsRuntime_);
     napi_env env = reinterpret_cast<napi_env>(&jsRuntime_.GetNativeEngine());
 
@@ -358,7 +358,7 @@ int JsFileExtAbility::Rename(const Uri &sourceFileUri, const std::string &displa
         ret = NO_ERROR;
     }
     newFileUri = Uri(uriStr);
-    HILOG_INFO("tag dsa %{public}s end. return fd:%{public}d, newFileUri = %{public}s", __func__, ret, uriStr.c_str());
+    HILOG_DEBUG("tag dsa %{public}s end. return fd:%{public}d, newFileUri = %{public}s", __func__, ret, uriStr.c_str());
     return ret;
 }
 } // namespace AbilityRuntime
@@ -61,6 +61,7 @@ UniError DealWithErrno(int err)
 {
     unordered_map<int, int> errMap = {
         {FAIL, ESRCH},
+        {E_SERVICE_DIED, ESRCH},
         {E_CREATE_FAIL, EPERM},
         {E_NOEXIST, ENOENT},
         {E_EMPTYFOLDER, ENOTDIR},
@@ -302,6 +303,36 @@ bool GetListFileOption(const NVal &argv, CmdOptions &option)
         }
         option.setCount(count);
     }
+    if (argv.HasProp("prefetch")) {
+        bool prefetch = false;
+        tie(ret, prefetch) = argv.GetProp("prefetch").ToBool();
+        if (!ret) {
+            ERR_LOG("ListFileArgs LF_OPTION prefetch para fails");
+            return false;
+        }
+        option.SetFlags(prefetch ? (option.GetFlags() | ListFileFlag::LIST_FILE_PREFETCH) :
+            (option.GetFlags() & ~ListFileFlag::LIST_FILE_PREFETCH));
+    }
+    if (argv.HasProp("cache")) {
+        bool cache = false;
+        tie(ret, cache) = argv.GetProp("cache").ToBool();
+        if (!ret) {
+            ERR_LOG("ListFileArgs LF_OPTION cache para fails");
+            return false;
+        }
+        option.SetFlags(cache ? (option.GetFlags() | ListFileFlag::LIST_FILE_CACHE) :
+            (option.GetFlags() & ~ListFileFlag::LIST_FILE_CACHE));
+    }
+    if (argv.HasProp("compact")) {
+        bool compact = false;
+        tie(ret, compact) = argv.GetProp("compact").ToBool();
+        if (!ret) {
+            ERR_LOG("ListFileArgs LF_OPTION compact para fails");
+            return false;
+        }
+        option.SetFlags(compact ? (option.GetFlags() | ListFileFlag::LIST_FILE_COMPACT) :
+            (option.GetFlags() & ~ListFileFlag::LIST_FILE_COMPACT));
+    }
     return true;
 }
 
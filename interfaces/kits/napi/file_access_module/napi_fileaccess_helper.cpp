@@ -36,14 +36,14 @@ constexpr int INVALID_PARAMETER = -1;
 
 std::string NapiValueToStringUtf8(napi_env env, napi_value value)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     std::string result = "";
     return UnwrapStringFromJS(env, value, result);
 }
 
 int NapiValueToInt32Utf8(napi_env env, napi_value value)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     int result = 0;
     return UnwrapInt32FromJS(env, value, result);
 }
@@ -54,7 +54,7 @@ static napi_ref g_constructorRef = nullptr;
 
 napi_value AcquireFileAccessHelperWrap(napi_env env, napi_callback_info info, FileAccessHelperCB *fileAccessHelperCB)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     if (fileAccessHelperCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s,fileAccessHelperCB == nullptr", __func__);
         return nullptr;
@@ -93,13 +93,13 @@ napi_value AcquireFileAccessHelperWrap(napi_env env, napi_callback_info info, Fi
 
     delete fileAccessHelperCB;
     fileAccessHelperCB = nullptr;
-    HILOG_INFO("tag dsa %{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,end", __func__);
     return result;
 }
 
 napi_value NAPI_AcquireFileAccessHelperCommon(napi_env env, napi_callback_info info, AbilityType abilityType)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     FileAccessHelperCB *fileAccessHelperCB = new (std::nothrow) FileAccessHelperCB;
     if (fileAccessHelperCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, FileAccessHelperCB == nullptr", __func__);
@@ -118,19 +118,19 @@ napi_value NAPI_AcquireFileAccessHelperCommon(napi_env env, napi_callback_info i
         }
         ret = WrapVoidToJS(env);
     }
-    HILOG_INFO("tag dsa %{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,end", __func__);
     return ret;
 }
 
 napi_value NAPI_CreateFileAccessHelper(napi_env env, napi_callback_info info)
 {
-    HILOG_INFO("tag dsa %{public}s, called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, called", __func__);
     return NAPI_AcquireFileAccessHelperCommon(env, info,  AbilityType::EXTENSION);
 }
 
 napi_value FileAccessHelperInit(napi_env env, napi_value exports)
 {
-    HILOG_INFO("tag dsa %{public}s,called start ", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called start ", __func__);
     napi_property_descriptor properties[] = {
         DECLARE_NAPI_FUNCTION("openFile", NAPI_OpenFile),
         DECLARE_NAPI_FUNCTION("mkdir", NAPI_Mkdir),
@@ -165,7 +165,7 @@ napi_value FileAccessHelperInit(napi_env env, napi_value exports)
 
 napi_value FileAccessHelperConstructor(napi_env env, napi_callback_info info)
 {
-    HILOG_INFO("tag dsa %{public}s, called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, called", __func__);
     size_t argc = ARGS_TWO;
     napi_value argv[ARGS_TWO] = {nullptr};
     napi_value thisVar = nullptr;
@@ -177,12 +177,12 @@ napi_value FileAccessHelperConstructor(napi_env env, napi_callback_info info)
     bool isStageMode = false;
     napi_status status = AbilityRuntime::IsStageContext(env, argv[PARAM0], isStageMode);
     if (status != napi_ok || !isStageMode) {
-        HILOG_INFO("tag dsa FA Model");
+        HILOG_DEBUG("tag dsa FA Model");
         return nullptr;
     } else {
         auto context = OHOS::AbilityRuntime::GetStageModeContext(env, argv[PARAM0]);
         NAPI_ASSERT(env, context != nullptr, "FileAccessHelperConstructor: failed to get native context");
-        HILOG_INFO("tag dsa Stage Model");
+        HILOG_DEBUG("tag dsa Stage Model");
         fileAccessHelper = FileAccessHelper::Creator(context, want);
     }
     NAPI_ASSERT(env, fileAccessHelper != nullptr, "FileAccessHelperConstructor: fileAccessHelper is nullptr");
@@ -193,13 +193,13 @@ napi_value FileAccessHelperConstructor(napi_env env, napi_callback_info info)
                     return objectInfo == fileAccessHelper.get();
                 });
         }, nullptr, nullptr);
-    HILOG_INFO("tag dsa %{public}s,called end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called end", __func__);
     return thisVar;
 }
 
 napi_value NAPI_OpenFile(napi_env env, napi_callback_info info)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     FileAccessHelperOpenFileCB *openFileCB = new (std::nothrow) FileAccessHelperOpenFileCB;
     if (openFileCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, openFileCB == nullptr.", __func__);
@@ -219,13 +219,13 @@ napi_value NAPI_OpenFile(napi_env env, napi_callback_info info)
         }
         ret = WrapVoidToJS(env);
     }
-    HILOG_INFO("tag dsa %{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,end", __func__);
     return ret;
 }
 
 napi_value OpenFileWrap(napi_env env, napi_callback_info info, FileAccessHelperOpenFileCB *openFileCB)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     size_t argcAsync = ARGS_THREE;
     const size_t argcPromise = ARGS_TWO;
     const size_t argCountWithAsync = argcPromise + ARGS_ASYNC_COUNT;
@@ -243,18 +243,18 @@ napi_value OpenFileWrap(napi_env env, napi_callback_info info, FileAccessHelperO
     NAPI_CALL(env, napi_typeof(env, args[PARAM0], &valuetype));
     if (valuetype == napi_string) {
         openFileCB->uri = NapiValueToStringUtf8(env, args[PARAM0]);
-        HILOG_INFO("tag dsa %{public}s,uri=%{public}s", __func__, openFileCB->uri.c_str());
+        HILOG_DEBUG("tag dsa %{public}s,uri=%{public}s", __func__, openFileCB->uri.c_str());
     }
 
     NAPI_CALL(env, napi_typeof(env, args[PARAM1], &valuetype));
     if (valuetype == napi_string) {
         openFileCB->mode = NapiValueToStringUtf8(env, args[PARAM1]);
-        HILOG_INFO("tag dsa %{public}s,mode=%{public}s", __func__, openFileCB->mode.c_str());
+        HILOG_DEBUG("tag dsa %{public}s,mode=%{public}s", __func__, openFileCB->mode.c_str());
     }
 
     FileAccessHelper *objectInfo = nullptr;
     napi_unwrap(env, thisVar, (void **)&objectInfo);
-    HILOG_INFO("tag dsa %{public}s,FileAccessHelper objectInfo", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,FileAccessHelper objectInfo", __func__);
     openFileCB->fileAccessHelper = objectInfo;
 
     if (argcAsync > argcPromise) {
@@ -262,13 +262,13 @@ napi_value OpenFileWrap(napi_env env, napi_callback_info info, FileAccessHelperO
     } else {
         ret = OpenFilePromise(env, openFileCB);
     }
-    HILOG_INFO("tag dsa %{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,end", __func__);
     return ret;
 }
 
 napi_value OpenFileAsync(napi_env env, napi_value *args, const size_t argCallback, FileAccessHelperOpenFileCB *openFileCB)
 {
-    HILOG_INFO("tag dsa %{public}s, asyncCallback.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, asyncCallback.", __func__);
     if (args == nullptr || openFileCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, param == nullptr.", __func__);
         return nullptr;
@@ -293,13 +293,13 @@ napi_value OpenFileAsync(napi_env env, napi_value *args, const size_t argCallbac
     NAPI_CALL(env, napi_queue_async_work(env, openFileCB->cbBase.asyncWork));
     napi_value result = 0;
     NAPI_CALL(env, napi_get_null(env, &result));
-    HILOG_INFO("tag dsa %{public}s, asyncCallback end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, asyncCallback end.", __func__);
     return result;
 }
 
 napi_value OpenFilePromise(napi_env env, FileAccessHelperOpenFileCB *openFileCB)
 {
-    HILOG_INFO("tag dsa %{public}s, promise.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, promise.", __func__);
     if (openFileCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, param == nullptr.", __func__);
         return nullptr;
@@ -320,13 +320,13 @@ napi_value OpenFilePromise(napi_env env, FileAccessHelperOpenFileCB *openFileCB)
             (void *)openFileCB,
             &openFileCB->cbBase.asyncWork));
     NAPI_CALL(env, napi_queue_async_work(env, openFileCB->cbBase.asyncWork));
-    HILOG_INFO("tag dsa %{public}s, promise end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, promise end.", __func__);
     return promise;
 }
 
 void OpenFileExecuteCB(napi_env env, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_OpenFile, worker pool thread execute.");
+    HILOG_DEBUG("tag dsa NAPI_OpenFile, worker pool thread execute.");
     FileAccessHelperOpenFileCB *OpenFileCB = static_cast<FileAccessHelperOpenFileCB *>(data);
     if (OpenFileCB->fileAccessHelper != nullptr) {
         OpenFileCB->execResult = INVALID_PARAMETER;
@@ -340,12 +340,12 @@ void OpenFileExecuteCB(napi_env env, void *data)
     } else {
         HILOG_ERROR("tag dsa NAPI_OpenFile, fileAccessHelper == nullptr");
     }
-    HILOG_INFO("tag dsa NAPI_OpenFile, worker pool thread execute end.");
+    HILOG_DEBUG("tag dsa NAPI_OpenFile, worker pool thread execute end.");
 }
 
 void OpenFileAsyncCompleteCB(napi_env env, napi_status status, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_OpenFile, main event thread complete.");
+    HILOG_DEBUG("tag dsa NAPI_OpenFile, main event thread complete.");
     FileAccessHelperOpenFileCB *OpenFileCB = static_cast<FileAccessHelperOpenFileCB *>(data);
     napi_value callback = nullptr;
     napi_value undefined = nullptr;
@@ -364,12 +364,12 @@ void OpenFileAsyncCompleteCB(napi_env env, napi_status status, void *data)
     NAPI_CALL_RETURN_VOID(env, napi_delete_async_work(env, OpenFileCB->cbBase.asyncWork));
     delete OpenFileCB;
     OpenFileCB = nullptr;
-    HILOG_INFO("tag dsa NAPI_OpenFile, main event thread complete end.");
+    HILOG_DEBUG("tag dsa NAPI_OpenFile, main event thread complete end.");
 }
 
 void OpenFilePromiseCompleteCB(napi_env env, napi_status status, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_OpenFileCB,  main event thread complete.");
+    HILOG_DEBUG("tag dsa NAPI_OpenFileCB,  main event thread complete.");
     FileAccessHelperOpenFileCB *OpenFileCB = static_cast<FileAccessHelperOpenFileCB *>(data);
     napi_value result = nullptr;
     napi_create_int32(env, OpenFileCB->result, &result);
@@ -377,12 +377,12 @@ void OpenFilePromiseCompleteCB(napi_env env, napi_status status, void *data)
     NAPI_CALL_RETURN_VOID(env, napi_delete_async_work(env, OpenFileCB->cbBase.asyncWork));
     delete OpenFileCB;
     OpenFileCB = nullptr;
-    HILOG_INFO("tag dsa NAPI_OpenFileCB,  main event thread complete end.");
+    HILOG_DEBUG("tag dsa NAPI_OpenFileCB,  main event thread complete end.");
 }
 
 napi_value NAPI_CreateFile(napi_env env, napi_callback_info info)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     FileAccessHelperCreateFileCB *createFileCB = new (std::nothrow) FileAccessHelperCreateFileCB;
     if (createFileCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, createFileCB == nullptr.", __func__);
@@ -402,13 +402,13 @@ napi_value NAPI_CreateFile(napi_env env, napi_callback_info info)
         }
         ret = WrapVoidToJS(env);
     }
-    HILOG_INFO("tag dsa %{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,end", __func__);
     return ret;
 }
 
 napi_value CreateFileWrap(napi_env env, napi_callback_info info, FileAccessHelperCreateFileCB *createFileCB)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     size_t argcAsync = ARGS_THREE;
     const size_t argcPromise = ARGS_TWO;
     const size_t argCountWithAsync = argcPromise + ARGS_ASYNC_COUNT;
@@ -426,18 +426,18 @@ napi_value CreateFileWrap(napi_env env, napi_callback_info info, FileAccessHelpe
     NAPI_CALL(env, napi_typeof(env, args[PARAM0], &valuetype));
     if (valuetype == napi_string) {
         createFileCB->parentUri = NapiValueToStringUtf8(env, args[PARAM0]);
-        HILOG_INFO("tag dsa %{public}s,parentUri=%{public}s", __func__, createFileCB->parentUri.c_str());
+        HILOG_DEBUG("tag dsa %{public}s,parentUri=%{public}s", __func__, createFileCB->parentUri.c_str());
     }
 
     NAPI_CALL(env, napi_typeof(env, args[PARAM1], &valuetype));
     if (valuetype == napi_string) {
         createFileCB->name = NapiValueToStringUtf8(env, args[PARAM1]);
-        HILOG_INFO("tag dsa %{public}s,name=%{public}s", __func__, createFileCB->name.c_str());
+        HILOG_DEBUG("tag dsa %{public}s,name=%{public}s", __func__, createFileCB->name.c_str());
     }
 
     FileAccessHelper *objectInfo = nullptr;
     napi_unwrap(env, thisVar, (void **)&objectInfo);
-    HILOG_INFO("tag dsa %{public}s,FileAccessHelper objectInfo", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,FileAccessHelper objectInfo", __func__);
     createFileCB->fileAccessHelper = objectInfo;
 
     if (argcAsync > argcPromise) {
@@ -445,13 +445,13 @@ napi_value CreateFileWrap(napi_env env, napi_callback_info info, FileAccessHelpe
     } else {
         ret = CreateFilePromise(env, createFileCB);
     }
-    HILOG_INFO("tag dsa %{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,end", __func__);
     return ret;
 }
 
 napi_value CreateFileAsync(napi_env env, napi_value *args, const size_t argCallback, FileAccessHelperCreateFileCB *createFileCB)
 {
-    HILOG_INFO("tag dsa %{public}s, asyncCallback.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, asyncCallback.", __func__);
     if (args == nullptr || createFileCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, param == nullptr.", __func__);
         return nullptr;
@@ -476,13 +476,13 @@ napi_value CreateFileAsync(napi_env env, napi_value *args, const size_t argCallb
     NAPI_CALL(env, napi_queue_async_work(env, createFileCB->cbBase.asyncWork));
     napi_value result = 0;
     NAPI_CALL(env, napi_get_null(env, &result));
-    HILOG_INFO("tag dsa %{public}s, asyncCallback end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, asyncCallback end.", __func__);
     return result;
 }
 
 napi_value CreateFilePromise(napi_env env, FileAccessHelperCreateFileCB *createFileCB)
 {
-    HILOG_INFO("tag dsa %{public}s, promise.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, promise.", __func__);
     if (createFileCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, param == nullptr.", __func__);
         return nullptr;
@@ -503,13 +503,13 @@ napi_value CreateFilePromise(napi_env env, FileAccessHelperCreateFileCB *createF
             (void *)createFileCB,
             &createFileCB->cbBase.asyncWork));
     NAPI_CALL(env, napi_queue_async_work(env, createFileCB->cbBase.asyncWork));
-    HILOG_INFO("tag dsa %{public}s, promise end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, promise end.", __func__);
     return promise;
 }
 
 void CreateFileExecuteCB(napi_env env, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_CreateFile, worker pool thread execute.");
+    HILOG_DEBUG("tag dsa NAPI_CreateFile, worker pool thread execute.");
     FileAccessHelperCreateFileCB *CreateFileCB = static_cast<FileAccessHelperCreateFileCB *>(data);
     if (CreateFileCB->fileAccessHelper != nullptr) {
         CreateFileCB->execResult = INVALID_PARAMETER;
@@ -526,12 +526,12 @@ void CreateFileExecuteCB(napi_env env, void *data)
     } else {
         HILOG_ERROR("tag dsa NAPI_CreateFile, fileAccessHelper == nullptr");
     }
-    HILOG_INFO("tag dsa NAPI_CreateFile, worker pool thread execute end.");
+    HILOG_DEBUG("tag dsa NAPI_CreateFile, worker pool thread execute end.");
 }
 
 void CreateFileAsyncCompleteCB(napi_env env, napi_status status, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_CreateFile, main event thread complete.");
+    HILOG_DEBUG("tag dsa NAPI_CreateFile, main event thread complete.");
     FileAccessHelperCreateFileCB *CreateFileCB = static_cast<FileAccessHelperCreateFileCB *>(data);
     napi_value callback = nullptr;
     napi_value undefined = nullptr;
@@ -551,12 +551,12 @@ void CreateFileAsyncCompleteCB(napi_env env, napi_status status, void *data)
     NAPI_CALL_RETURN_VOID(env, napi_delete_async_work(env, CreateFileCB->cbBase.asyncWork));
     delete CreateFileCB;
     CreateFileCB = nullptr;
-    HILOG_INFO("tag dsa NAPI_CreateFile, main event thread complete end.");
+    HILOG_DEBUG("tag dsa NAPI_CreateFile, main event thread complete end.");
 }
 
 void CreateFilePromiseCompleteCB(napi_env env, napi_status status, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_CreateFile,  main event thread complete.");
+    HILOG_DEBUG("tag dsa NAPI_CreateFile,  main event thread complete.");
     FileAccessHelperCreateFileCB *CreateFileCB = static_cast<FileAccessHelperCreateFileCB *>(data);
     napi_value result = nullptr;
     NAPI_CALL_RETURN_VOID(env, napi_create_string_utf8(env, CreateFileCB->result.c_str(), NAPI_AUTO_LENGTH, &result));
@@ -564,12 +564,12 @@ void CreateFilePromiseCompleteCB(napi_env env, napi_status status, void *data)
     NAPI_CALL_RETURN_VOID(env, napi_delete_async_work(env, CreateFileCB->cbBase.asyncWork));
     delete CreateFileCB;
     CreateFileCB = nullptr;
-    HILOG_INFO("tag dsa NAPI_CreateFile,  main event thread complete end.");
+    HILOG_DEBUG("tag dsa NAPI_CreateFile,  main event thread complete end.");
 }
 
 napi_value NAPI_Mkdir(napi_env env, napi_callback_info info)
 {
-    HILOG_INFO("tag dsa%{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa%{public}s,called", __func__);
     FileAccessHelperMkdirCB *mkdirCB = new (std::nothrow) FileAccessHelperMkdirCB;
     if (mkdirCB == nullptr) {
         HILOG_ERROR("tag dsa%{public}s, mkdirCB == nullptr.", __func__);
@@ -589,13 +589,13 @@ napi_value NAPI_Mkdir(napi_env env, napi_callback_info info)
         }
         ret = WrapVoidToJS(env);
     }
-    HILOG_INFO("tag dsa%{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa%{public}s,end", __func__);
     return ret;
 }
 
 napi_value MkdirWrap(napi_env env, napi_callback_info info, FileAccessHelperMkdirCB *mkdirCB)
 {
-    HILOG_INFO("tag dsa%{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa%{public}s,called", __func__);
     size_t argcAsync = ARGS_THREE;
     const size_t argcPromise = ARGS_TWO;
     const size_t argCountWithAsync = argcPromise + ARGS_ASYNC_COUNT;
@@ -613,18 +613,18 @@ napi_value MkdirWrap(napi_env env, napi_callback_info info, FileAccessHelperMkdi
     NAPI_CALL(env, napi_typeof(env, args[PARAM0], &valuetype));
     if (valuetype == napi_string) {
         mkdirCB->parentUri = NapiValueToStringUtf8(env, args[PARAM0]);
-        HILOG_INFO("tag dsa%{public}s,parentUri=%{public}s", __func__, mkdirCB->parentUri.c_str());
+        HILOG_DEBUG("tag dsa%{public}s,parentUri=%{public}s", __func__, mkdirCB->parentUri.c_str());
     }
 
     NAPI_CALL(env, napi_typeof(env, args[PARAM1], &valuetype));
     if (valuetype == napi_string) {
         mkdirCB->name = NapiValueToStringUtf8(env, args[PARAM1]);
-        HILOG_INFO("tag dsa%{public}s,name=%{public}s", __func__, mkdirCB->name.c_str());
+        HILOG_DEBUG("tag dsa%{public}s,name=%{public}s", __func__, mkdirCB->name.c_str());
     }
 
     FileAccessHelper *objectInfo = nullptr;
     napi_unwrap(env, thisVar, (void **)&objectInfo);
-    HILOG_INFO("tag dsa%{public}s,FileAccessHelper objectInfo", __func__);
+    HILOG_DEBUG("tag dsa%{public}s,FileAccessHelper objectInfo", __func__);
     mkdirCB->fileAccessHelper = objectInfo;
 
     if (argcAsync > argcPromise) {
@@ -632,13 +632,13 @@ napi_value MkdirWrap(napi_env env, napi_callback_info info, FileAccessHelperMkdi
     } else {
         ret = MkdirPromise(env, mkdirCB);
     }
-    HILOG_INFO("tag dsa%{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa%{public}s,end", __func__);
     return ret;
 }
 
 napi_value MkdirAsync(napi_env env, napi_value *args, const size_t argCallback, FileAccessHelperMkdirCB *mkdirCB)
 {
-    HILOG_INFO("tag dsa%{public}s, asyncCallback.", __func__);
+    HILOG_DEBUG("tag dsa%{public}s, asyncCallback.", __func__);
     if (args == nullptr || mkdirCB == nullptr) {
         HILOG_ERROR("tag dsa%{public}s, param == nullptr.", __func__);
         return nullptr;
@@ -663,13 +663,13 @@ napi_value MkdirAsync(napi_env env, napi_value *args, const size_t argCallback,
     NAPI_CALL(env, napi_queue_async_work(env, mkdirCB->cbBase.asyncWork));
     napi_value result = 0;
     NAPI_CALL(env, napi_get_null(env, &result));
-    HILOG_INFO("tag dsa%{public}s, asyncCallback end.", __func__);
+    HILOG_DEBUG("tag dsa%{public}s, asyncCallback end.", __func__);
     return result;
 }
 
 napi_value MkdirPromise(napi_env env, FileAccessHelperMkdirCB *mkdirCB)
 {
-    HILOG_INFO("tag dsa%{public}s, promise.", __func__);
+    HILOG_DEBUG("tag dsa%{public}s, promise.", __func__);
     if (mkdirCB == nullptr) {
         HILOG_ERROR("tag dsa%{public}s, param == nullptr.", __func__);
         return nullptr;
@@ -690,13 +690,13 @@ napi_value MkdirPromise(napi_env env, FileAccessHelperMkdirCB *mkdirCB)
             (void *)mkdirCB,
             &mkdirCB->cbBase.asyncWork));
     NAPI_CALL(env, napi_queue_async_work(env, mkdirCB->cbBase.asyncWork));
-    HILOG_INFO("tag dsa%{public}s, promise end.", __func__);
+    HILOG_DEBUG("tag dsa%{public}s, promise end.", __func__);
     return promise;
 }
 
 void MkdirExecuteCB(napi_env env, void *data)
 {
-    HILOG_INFO("tag dsaNAPI_Mkdir, worker pool thread execute.");
+    HILOG_DEBUG("tag dsaNAPI_Mkdir, worker pool thread execute.");
     FileAccessHelperMkdirCB *MkdirCB = static_cast<FileAccessHelperMkdirCB *>(data);
     if (MkdirCB->fileAccessHelper != nullptr) {
         MkdirCB->execResult = INVALID_PARAMETER;
@@ -713,12 +713,12 @@ void MkdirExecuteCB(napi_env env, void *data)
     } else {
         HILOG_ERROR("tag dsaNAPI_Mkdir, fileAccessHelper == nullptr");
     }
-    HILOG_INFO("tag dsaNAPI_Mkdir, worker pool thread execute end.");
+    HILOG_DEBUG("tag dsaNAPI_Mkdir, worker pool thread execute end.");
 }
 
 void MkdirAsyncCompleteCB(napi_env env, napi_status status, void *data)
 {
-    HILOG_INFO("tag dsaNAPI_Mkdir, main event thread complete.");
+    HILOG_DEBUG("tag dsaNAPI_Mkdir, main event thread complete.");
     FileAccessHelperMkdirCB *MkdirCB = static_cast<FileAccessHelperMkdirCB *>(data);
     napi_value callback = nullptr;
     napi_value undefined = nullptr;
@@ -738,12 +738,12 @@ void MkdirAsyncCompleteCB(napi_env env, napi_status status, void *data)
     NAPI_CALL_RETURN_VOID(env, napi_delete_async_work(env, MkdirCB->cbBase.asyncWork));
     delete MkdirCB;
     MkdirCB = nullptr;
-    HILOG_INFO("tag dsaNAPI_Mkdir, main event thread complete end.");
+    HILOG_DEBUG("tag dsaNAPI_Mkdir, main event thread complete end.");
 }
 
 void MkdirPromiseCompleteCB(napi_env env, napi_status status, void *data)
 {
-    HILOG_INFO("tag dsaNAPI_Mkdir,  main event thread complete.");
+    HILOG_DEBUG("tag dsaNAPI_Mkdir,  main event thread complete.");
     FileAccessHelperMkdirCB *MkdirCB = static_cast<FileAccessHelperMkdirCB *>(data);
     napi_value result = nullptr;
     NAPI_CALL_RETURN_VOID(env, napi_create_string_utf8(env, MkdirCB->result.c_str(), NAPI_AUTO_LENGTH, &result));
@@ -751,12 +751,12 @@ void MkdirPromiseCompleteCB(napi_env env, napi_status status, void *data)
     NAPI_CALL_RETURN_VOID(env, napi_delete_async_work(env, MkdirCB->cbBase.asyncWork));
     delete MkdirCB;
     MkdirCB = nullptr;
-    HILOG_INFO("tag dsaNAPI_Mkdir,  main event thread complete end.");
+    HILOG_DEBUG("tag dsaNAPI_Mkdir,  main event thread complete end.");
 }
 
 napi_value NAPI_Delete(napi_env env, napi_callback_info info)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     FileAccessHelperDeleteCB *deleteCB = new (std::nothrow) FileAccessHelperDeleteCB;
     if (deleteCB == nullptr) {
         HILOG_ERROR("%{public}s, deleteCB == nullptr.", __func__);
@@ -776,13 +776,13 @@ napi_value NAPI_Delete(napi_env env, napi_callback_info info)
         }
         ret = WrapVoidToJS(env);
     }
-    HILOG_INFO("tag dsa %{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,end", __func__);
     return ret;
 }
 
 napi_value DeleteWrap(napi_env env, napi_callback_info info, FileAccessHelperDeleteCB *deleteCB)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     size_t argcAsync = ARGS_TWO;
     const size_t argcPromise = ARGS_ONE;
     const size_t argCountWithAsync = argcPromise + ARGS_ASYNC_COUNT;
@@ -800,12 +800,12 @@ napi_value DeleteWrap(napi_env env, napi_callback_info info, FileAccessHelperDel
     NAPI_CALL(env, napi_typeof(env, args[PARAM0], &valuetype));
     if (valuetype == napi_string) {
         deleteCB->selectFileUri = NapiValueToStringUtf8(env, args[PARAM0]);
-        HILOG_INFO("tag dsa %{public}s,selectFileUri=%{public}s", __func__, deleteCB->selectFileUri.c_str());
+        HILOG_DEBUG("tag dsa %{public}s,selectFileUri=%{public}s", __func__, deleteCB->selectFileUri.c_str());
     }
 
     FileAccessHelper *objectInfo = nullptr;
     napi_unwrap(env, thisVar, (void **)&objectInfo);
-    HILOG_INFO("tag dsa %{public}s,FileAccessHelper objectInfo", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,FileAccessHelper objectInfo", __func__);
     deleteCB->fileAccessHelper = objectInfo;
 
     if (argcAsync > argcPromise) {
@@ -813,13 +813,13 @@ napi_value DeleteWrap(napi_env env, napi_callback_info info, FileAccessHelperDel
     } else {
         ret = DeletePromise(env, deleteCB);
     }
-    HILOG_INFO("tag dsa %{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,end", __func__);
     return ret;
 }
 
 napi_value DeleteAsync(napi_env env, napi_value *args, const size_t argCallback, FileAccessHelperDeleteCB *deleteCB)
 {
-    HILOG_INFO("tag dsa %{public}s, asyncCallback.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, asyncCallback.", __func__);
     if (args == nullptr || deleteCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, param == nullptr.", __func__);
         return nullptr;
@@ -844,13 +844,13 @@ napi_value DeleteAsync(napi_env env, napi_value *args, const size_t argCallback,
     NAPI_CALL(env, napi_queue_async_work(env, deleteCB->cbBase.asyncWork));
     napi_value result = 0;
     NAPI_CALL(env, napi_get_null(env, &result));
-    HILOG_INFO("tag dsa %{public}s, asyncCallback end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, asyncCallback end.", __func__);
     return result;
 }
 
 napi_value DeletePromise(napi_env env, FileAccessHelperDeleteCB *deleteCB)
 {
-    HILOG_INFO("tag dsa %{public}s, promise.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, promise.", __func__);
     if (deleteCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, param == nullptr.", __func__);
         return nullptr;
@@ -871,13 +871,13 @@ napi_value DeletePromise(napi_env env, FileAccessHelperDeleteCB *deleteCB)
             (void *)deleteCB,
             &deleteCB->cbBase.asyncWork));
     NAPI_CALL(env, napi_queue_async_work(env, deleteCB->cbBase.asyncWork));
-    HILOG_INFO("tag dsa %{public}s, promise end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, promise end.", __func__);
     return promise;
 }
 
 void DeleteExecuteCB(napi_env env, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_Delete, worker pool thread execute.");
+    HILOG_DEBUG("tag dsa NAPI_Delete, worker pool thread execute.");
     FileAccessHelperDeleteCB *DeleteCB = static_cast<FileAccessHelperDeleteCB *>(data);
     if (DeleteCB->fileAccessHelper != nullptr) {
         DeleteCB->execResult = INVALID_PARAMETER;
@@ -891,12 +891,12 @@ void DeleteExecuteCB(napi_env env, void *data)
     } else {
         HILOG_ERROR("tag dsa NAPI_Delete, fileAccessHelper == nullptr");
     }
-    HILOG_INFO("tag dsa NAPI_Delete, worker pool thread execute end.");
+    HILOG_DEBUG("tag dsa NAPI_Delete, worker pool thread execute end.");
 }
 
 void DeleteAsyncCompleteCB(napi_env env, napi_status status, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_Delete, main event thread complete.");
+    HILOG_DEBUG("tag dsa NAPI_Delete, main event thread complete.");
     FileAccessHelperDeleteCB *DeleteCB = static_cast<FileAccessHelperDeleteCB *>(data);
     napi_value callback = nullptr;
     napi_value undefined = nullptr;
@@ -915,12 +915,12 @@ void DeleteAsyncCompleteCB(napi_env env, napi_status status, void *data)
     NAPI_CALL_RETURN_VOID(env, napi_delete_async_work(env, DeleteCB->cbBase.asyncWork));
     delete DeleteCB;
     DeleteCB = nullptr;
-    HILOG_INFO("tag dsa NAPI_Delete, main event thread complete end.");
+    HILOG_DEBUG("tag dsa NAPI_Delete, main event thread complete end.");
 }
 
 void DeletePromiseCompleteCB(napi_env env, napi_status status, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_Delete,  main event thread complete.");
+    HILOG_DEBUG("tag dsa NAPI_Delete,  main event thread complete.");
     FileAccessHelperDeleteCB *DeleteCB = static_cast<FileAccessHelperDeleteCB *>(data);
     napi_value result = nullptr;
     napi_create_int32(env, DeleteCB->result, &result);
@@ -928,12 +928,12 @@ void DeletePromiseCompleteCB(napi_env env, napi_status status, void *data)
     NAPI_CALL_RETURN_VOID(env, napi_delete_async_work(env, DeleteCB->cbBase.asyncWork));
     delete DeleteCB;
     DeleteCB = nullptr;
-    HILOG_INFO("tag dsa NAPI_Delete,  main event thread complete end.");
+    HILOG_DEBUG("tag dsa NAPI_Delete,  main event thread complete end.");
 }
 
 napi_value NAPI_Move(napi_env env, napi_callback_info info)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     FileAccessHelperMoveCB *moveCB = new (std::nothrow) FileAccessHelperMoveCB;
     if (moveCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, moveCB == nullptr.", __func__);
@@ -953,13 +953,13 @@ napi_value NAPI_Move(napi_env env, napi_callback_info info)
         }
         ret = WrapVoidToJS(env);
     }
-    HILOG_INFO("tag dsa %{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,end", __func__);
     return ret;
 }
 
 napi_value MoveWrap(napi_env env, napi_callback_info info, FileAccessHelperMoveCB *moveCB)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     size_t argcAsync = ARGS_THREE;
     const size_t argcPromise = ARGS_TWO;
     const size_t argCountWithAsync = argcPromise + ARGS_ASYNC_COUNT;
@@ -977,18 +977,18 @@ napi_value MoveWrap(napi_env env, napi_callback_info info, FileAccessHelperMoveC
     NAPI_CALL(env, napi_typeof(env, args[PARAM0], &valuetype));
     if (valuetype == napi_string) {
         moveCB->sourceFileUri = NapiValueToStringUtf8(env, args[PARAM0]);
-        HILOG_INFO("tag dsa %{public}s,sourceFileUri=%{public}s", __func__, moveCB->sourceFileUri.c_str());
+        HILOG_DEBUG("tag dsa %{public}s,sourceFileUri=%{public}s", __func__, moveCB->sourceFileUri.c_str());
     }
 
     NAPI_CALL(env, napi_typeof(env, args[PARAM1], &valuetype));
     if (valuetype == napi_string) {
         moveCB->targetParentUri = NapiValueToStringUtf8(env, args[PARAM1]);
-        HILOG_INFO("tag dsa %{public}s,targetParentUri=%{public}s", __func__, moveCB->targetParentUri.c_str());
+        HILOG_DEBUG("tag dsa %{public}s,targetParentUri=%{public}s", __func__, moveCB->targetParentUri.c_str());
     }
 
     FileAccessHelper *objectInfo = nullptr;
     napi_unwrap(env, thisVar, (void **)&objectInfo);
-    HILOG_INFO("tag dsa %{public}s,FileAccessHelper objectInfo", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,FileAccessHelper objectInfo", __func__);
     moveCB->fileAccessHelper = objectInfo;
 
     if (argcAsync > argcPromise) {
@@ -996,13 +996,13 @@ napi_value MoveWrap(napi_env env, napi_callback_info info, FileAccessHelperMoveC
     } else {
         ret = MovePromise(env, moveCB);
     }
-    HILOG_INFO("tag dsa %{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,end", __func__);
     return ret;
 }
 
 napi_value MoveAsync(napi_env env, napi_value *args, const size_t argCallback, FileAccessHelperMoveCB *moveCB)
 {
-    HILOG_INFO("tag dsa %{public}s, asyncCallback.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, asyncCallback.", __func__);
     if (args == nullptr || moveCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, param == nullptr.", __func__);
         return nullptr;
@@ -1027,13 +1027,13 @@ napi_value MoveAsync(napi_env env, napi_value *args, const size_t argCallback, F
     NAPI_CALL(env, napi_queue_async_work(env, moveCB->cbBase.asyncWork));
     napi_value result = 0;
     NAPI_CALL(env, napi_get_null(env, &result));
-    HILOG_INFO("tag dsa %{public}s, asyncCallback end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, asyncCallback end.", __func__);
     return result;
 }
 
 napi_value MovePromise(napi_env env, FileAccessHelperMoveCB *moveCB)
 {
-    HILOG_INFO("tag dsa %{public}s, promise.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, promise.", __func__);
     if (moveCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, param == nullptr.", __func__);
         return nullptr;
@@ -1054,13 +1054,13 @@ napi_value MovePromise(napi_env env, FileAccessHelperMoveCB *moveCB)
             (void *)moveCB,
             &moveCB->cbBase.asyncWork));
     NAPI_CALL(env, napi_queue_async_work(env, moveCB->cbBase.asyncWork));
-    HILOG_INFO("tag dsa %{public}s, promise end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, promise end.", __func__);
     return promise;
 }
 
 void MoveExecuteCB(napi_env env, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_Move, worker pool thread execute.");
+    HILOG_DEBUG("tag dsa NAPI_Move, worker pool thread execute.");
     FileAccessHelperMoveCB *MoveCB = static_cast<FileAccessHelperMoveCB *>(data);
     if (MoveCB->fileAccessHelper != nullptr) {
         MoveCB->execResult = INVALID_PARAMETER;
@@ -1078,12 +1078,12 @@ void MoveExecuteCB(napi_env env, void *data)
     } else {
         HILOG_ERROR("tag dsa NAPI_Move, fileAccessHelper == nullptr");
     }
-    HILOG_INFO("tag dsa NAPI_Move, worker pool thread execute end.");
+    HILOG_DEBUG("tag dsa NAPI_Move, worker pool thread execute end.");
 }
 
 void MoveAsyncCompleteCB(napi_env env, napi_status status, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_Move, main event thread complete.");
+    HILOG_DEBUG("tag dsa NAPI_Move, main event thread complete.");
     FileAccessHelperCreateFileCB *MoveCB = static_cast<FileAccessHelperCreateFileCB *>(data);
     napi_value callback = nullptr;
     napi_value undefined = nullptr;
@@ -1103,12 +1103,12 @@ void MoveAsyncCompleteCB(napi_env env, napi_status status, void *data)
     NAPI_CALL_RETURN_VOID(env, napi_delete_async_work(env, MoveCB->cbBase.asyncWork));
     delete MoveCB;
     MoveCB = nullptr;
-    HILOG_INFO("tag dsa NAPI_Move, main event thread complete end.");
+    HILOG_DEBUG("tag dsa NAPI_Move, main event thread complete end.");
 }
 
 void MovePromiseCompleteCB(napi_env env, napi_status status, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_Move,  main event thread complete.");
+    HILOG_DEBUG("tag dsa NAPI_Move,  main event thread complete.");
     FileAccessHelperCreateFileCB *MoveCB = static_cast<FileAccessHelperCreateFileCB *>(data);
     napi_value result = nullptr;
     NAPI_CALL_RETURN_VOID(env, napi_create_string_utf8(env, MoveCB->result.c_str(), NAPI_AUTO_LENGTH, &result));
@@ -1116,12 +1116,12 @@ void MovePromiseCompleteCB(napi_env env, napi_status status, void *data)
     NAPI_CALL_RETURN_VOID(env, napi_delete_async_work(env, MoveCB->cbBase.asyncWork));
     delete MoveCB;
     MoveCB = nullptr;
-    HILOG_INFO("tag dsa NAPI_Move,  main event thread complete end.");
+    HILOG_DEBUG("tag dsa NAPI_Move,  main event thread complete end.");
 }
 
 napi_value NAPI_Rename(napi_env env, napi_callback_info info)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     FileAccessHelperRenameCB *renameCB = new (std::nothrow) FileAccessHelperRenameCB;
     if (renameCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, renameCB == nullptr.", __func__);
@@ -1141,13 +1141,13 @@ napi_value NAPI_Rename(napi_env env, napi_callback_info info)
         }
         ret = WrapVoidToJS(env);
     }
-    HILOG_INFO("tag dsa %{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,end", __func__);
     return ret;
 }
 
 napi_value RenameWrap(napi_env env, napi_callback_info info, FileAccessHelperRenameCB *renameCB)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     size_t argcAsync = ARGS_THREE;
     const size_t argcPromise = ARGS_TWO;
     const size_t argCountWithAsync = argcPromise + ARGS_ASYNC_COUNT;
@@ -1165,18 +1165,18 @@ napi_value RenameWrap(napi_env env, napi_callback_info info, FileAccessHelperRen
     NAPI_CALL(env, napi_typeof(env, args[PARAM0], &valuetype));
     if (valuetype == napi_string) {
         renameCB->sourceFileUri = NapiValueToStringUtf8(env, args[PARAM0]);
-        HILOG_INFO("tag dsa %{public}s,sourceFileUri=%{public}s", __func__, renameCB->sourceFileUri.c_str());
+        HILOG_DEBUG("tag dsa %{public}s,sourceFileUri=%{public}s", __func__, renameCB->sourceFileUri.c_str());
     }
 
     NAPI_CALL(env, napi_typeof(env, args[PARAM1], &valuetype));
     if (valuetype == napi_string) {
         renameCB->displayName = NapiValueToStringUtf8(env, args[PARAM1]);
-        HILOG_INFO("tag dsa %{public}s,displayName=%{public}s", __func__, renameCB->displayName.c_str());
+        HILOG_DEBUG("tag dsa %{public}s,displayName=%{public}s", __func__, renameCB->displayName.c_str());
     }
 
     FileAccessHelper *objectInfo = nullptr;
     napi_unwrap(env, thisVar, (void **)&objectInfo);
-    HILOG_INFO("tag dsa %{public}s,FileAccessHelper objectInfo", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,FileAccessHelper objectInfo", __func__);
     renameCB->fileAccessHelper = objectInfo;
 
     if (argcAsync > argcPromise) {
@@ -1184,13 +1184,13 @@ napi_value RenameWrap(napi_env env, napi_callback_info info, FileAccessHelperRen
     } else {
         ret = RenamePromise(env, renameCB);
     }
-    HILOG_INFO("tag dsa %{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,end", __func__);
     return ret;
 }
 
 napi_value RenameAsync(napi_env env, napi_value *args, const size_t argCallback, FileAccessHelperRenameCB *renameCB)
 {
-    HILOG_INFO("tag dsa %{public}s, asyncCallback.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, asyncCallback.", __func__);
     if (args == nullptr || renameCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, param == nullptr.", __func__);
         return nullptr;
@@ -1215,13 +1215,13 @@ napi_value RenameAsync(napi_env env, napi_value *args, const size_t argCallback,
     NAPI_CALL(env, napi_queue_async_work(env, renameCB->cbBase.asyncWork));
     napi_value result = 0;
     NAPI_CALL(env, napi_get_null(env, &result));
-    HILOG_INFO("tag dsa %{public}s, asyncCallback end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, asyncCallback end.", __func__);
     return result;
 }
 
 napi_value RenamePromise(napi_env env, FileAccessHelperRenameCB *renameCB)
 {
-    HILOG_INFO("tag dsa %{public}s, promise.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, promise.", __func__);
     if (renameCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, param == nullptr.", __func__);
         return nullptr;
@@ -1242,13 +1242,13 @@ napi_value RenamePromise(napi_env env, FileAccessHelperRenameCB *renameCB)
             (void *)renameCB,
             &renameCB->cbBase.asyncWork));
     NAPI_CALL(env, napi_queue_async_work(env, renameCB->cbBase.asyncWork));
-    HILOG_INFO("tag dsa %{public}s, promise end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, promise end.", __func__);
     return promise;
 }
 
 void RenameExecuteCB(napi_env env, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_Rename, worker pool thread execute.");
+    HILOG_DEBUG("tag dsa NAPI_Rename, worker pool thread execute.");
     FileAccessHelperRenameCB *renameCB = static_cast<FileAccessHelperRenameCB *>(data);
     if (renameCB->fileAccessHelper != nullptr) {
         renameCB->execResult = INVALID_PARAMETER;
@@ -1265,12 +1265,12 @@ void RenameExecuteCB(napi_env env, void *data)
     } else {
         HILOG_ERROR("tag dsa NAPI_Rename, fileAccessHelper == nullptr");
     }
-    HILOG_INFO("tag dsa NAPI_Rename, worker pool thread execute end.");
+    HILOG_DEBUG("tag dsa NAPI_Rename, worker pool thread execute end.");
 }
 
 void RenameAsyncCompleteCB(napi_env env, napi_status status, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_Rename, main event thread complete.");
+    HILOG_DEBUG("tag dsa NAPI_Rename, main event thread complete.");
     FileAccessHelperRenameCB *RenameCB = static_cast<FileAccessHelperRenameCB *>(data);
     napi_value callback = nullptr;
     napi_value undefined = nullptr;
@@ -1290,12 +1290,12 @@ void RenameAsyncCompleteCB(napi_env env, napi_status status, void *data)
     NAPI_CALL_RETURN_VOID(env, napi_delete_async_work(env, RenameCB->cbBase.asyncWork));
     delete RenameCB;
     RenameCB = nullptr;
-    HILOG_INFO("tag dsa NAPI_Rename, main event thread complete end.");
+    HILOG_DEBUG("tag dsa NAPI_Rename, main event thread complete end.");
 }
 
 void RenamePromiseCompleteCB(napi_env env, napi_status status, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_Rename,  main event thread complete.");
+    HILOG_DEBUG("tag dsa NAPI_Rename,  main event thread complete.");
     FileAccessHelperRenameCB *RenameCB = static_cast<FileAccessHelperRenameCB *>(data);
     napi_value result = nullptr;
     NAPI_CALL_RETURN_VOID(env, napi_create_string_utf8(env, RenameCB->result.c_str(), NAPI_AUTO_LENGTH, &result));
@@ -1303,12 +1303,12 @@ void RenamePromiseCompleteCB(napi_env env, napi_status status, void *data)
     NAPI_CALL_RETURN_VOID(env, napi_delete_async_work(env, RenameCB->cbBase.asyncWork));
     delete RenameCB;
     RenameCB = nullptr;
-    HILOG_INFO("tag dsa NAPI_Rename,  main event thread complete end.");
+    HILOG_DEBUG("tag dsa NAPI_Rename,  main event thread complete end.");
 }
 
 napi_value NAPI_CloseFile(napi_env env, napi_callback_info info)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     FileAccessHelperCloseFileCB *closeFileCB = new (std::nothrow) FileAccessHelperCloseFileCB;
     if (closeFileCB == nullptr) {
         HILOG_ERROR("%{public}s, closeFileCB == nullptr.", __func__);
@@ -1328,13 +1328,13 @@ napi_value NAPI_CloseFile(napi_env env, napi_callback_info info)
         }
         ret = WrapVoidToJS(env);
     }
-    HILOG_INFO("tag dsa %{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,end", __func__);
     return ret;
 }
 
 napi_value CloseFileWrap(napi_env env, napi_callback_info info, FileAccessHelperCloseFileCB *closeFileCB)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     size_t argcAsync = ARGS_THREE;
     const size_t argcPromise = ARGS_TWO;
     const size_t argCountWithAsync = argcPromise + ARGS_ASYNC_COUNT;
@@ -1352,18 +1352,18 @@ napi_value CloseFileWrap(napi_env env, napi_callback_info info, FileAccessHelper
     NAPI_CALL(env, napi_typeof(env, args[PARAM0], &valuetype));
     if (valuetype == napi_number) {
         closeFileCB->fd = NapiValueToInt32Utf8(env, args[PARAM0]);
-        HILOG_INFO("tag dsa %{public}s,fd=%d", __func__, closeFileCB->fd);
+        HILOG_DEBUG("tag dsa %{public}s,fd=%d", __func__, closeFileCB->fd);
     }
 
     NAPI_CALL(env, napi_typeof(env, args[PARAM1], &valuetype));
     if (valuetype == napi_string) {
         closeFileCB->uri = NapiValueToStringUtf8(env, args[PARAM1]);
-        HILOG_INFO("tag dsa %{public}s,uri=%{public}s", __func__, closeFileCB->uri.c_str());
+        HILOG_DEBUG("tag dsa %{public}s,uri=%{public}s", __func__, closeFileCB->uri.c_str());
     }
 
     FileAccessHelper *objectInfo = nullptr;
     napi_unwrap(env, thisVar, (void **)&objectInfo);
-    HILOG_INFO("tag dsa %{public}s,FileAccessHelper objectInfo", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,FileAccessHelper objectInfo", __func__);
     closeFileCB->fileAccessHelper = objectInfo;
 
     if (argcAsync > argcPromise) {
@@ -1371,13 +1371,13 @@ napi_value CloseFileWrap(napi_env env, napi_callback_info info, FileAccessHelper
     } else {
         ret = CloseFilePromise(env, closeFileCB);
     }
-    HILOG_INFO("tag dsa %{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,end", __func__);
     return ret;
 }
 
 napi_value CloseFileAsync(napi_env env, napi_value *args, const size_t argCallback, FileAccessHelperCloseFileCB *closeFileCB)
 {
-    HILOG_INFO("tag dsa %{public}s, asyncCallback.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, asyncCallback.", __func__);
     if (args == nullptr || closeFileCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, param == nullptr.", __func__);
         return nullptr;
@@ -1402,13 +1402,13 @@ napi_value CloseFileAsync(napi_env env, napi_value *args, const size_t argCallba
     NAPI_CALL(env, napi_queue_async_work(env, closeFileCB->cbBase.asyncWork));
     napi_value result = 0;
     NAPI_CALL(env, napi_get_null(env, &result));
-    HILOG_INFO("tag dsa %{public}s, asyncCallback end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, asyncCallback end.", __func__);
     return result;
 }
 
 napi_value CloseFilePromise(napi_env env, FileAccessHelperCloseFileCB *closeFileCB)
 {
-    HILOG_INFO("tag dsa %{public}s, promise.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, promise.", __func__);
     if (closeFileCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, param == nullptr.", __func__);
         return nullptr;
@@ -1429,13 +1429,13 @@ napi_value CloseFilePromise(napi_env env, FileAccessHelperCloseFileCB *closeFile
             (void *)closeFileCB,
             &closeFileCB->cbBase.asyncWork));
     NAPI_CALL(env, napi_queue_async_work(env, closeFileCB->cbBase.asyncWork));
-    HILOG_INFO("tag dsa %{public}s, promise end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, promise end.", __func__);
     return promise;
 }
 
 void CloseFileExecuteCB(napi_env env, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_CloseFile, worker pool thread execute.");
+    HILOG_DEBUG("tag dsa NAPI_CloseFile, worker pool thread execute.");
     FileAccessHelperCloseFileCB *CloseFileCB = static_cast<FileAccessHelperCloseFileCB *>(data);
     if (CloseFileCB->fileAccessHelper != nullptr) {
         CloseFileCB->execResult = INVALID_PARAMETER;
@@ -1448,12 +1448,12 @@ void CloseFileExecuteCB(napi_env env, void *data)
     } else {
         HILOG_ERROR("tag dsa NAPI_CloseFile, fileAccessHelper == nullptr");
     }
-    HILOG_INFO("tag dsa NAPI_CloseFile, worker pool thread execute end.");
+    HILOG_DEBUG("tag dsa NAPI_CloseFile, worker pool thread execute end.");
 }
 
 void CloseFileAsyncCompleteCB(napi_env env, napi_status status, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_CloseFile, main event thread complete.");
+    HILOG_DEBUG("tag dsa NAPI_CloseFile, main event thread complete.");
     FileAccessHelperCloseFileCB *CloseFileCB = static_cast<FileAccessHelperCloseFileCB *>(data);
     napi_value callback = nullptr;
     napi_value undefined = nullptr;
@@ -1472,12 +1472,12 @@ void CloseFileAsyncCompleteCB(napi_env env, napi_status status, void *data)
     NAPI_CALL_RETURN_VOID(env, napi_delete_async_work(env, CloseFileCB->cbBase.asyncWork));
     delete CloseFileCB;
     CloseFileCB = nullptr;
-    HILOG_INFO("tag dsa NAPI_CloseFile, main event thread complete end.");
+    HILOG_DEBUG("tag dsa NAPI_CloseFile, main event thread complete end.");
 }
 
 void CloseFilePromiseCompleteCB(napi_env env, napi_status status, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_CloseFile,  main event thread complete.");
+    HILOG_DEBUG("tag dsa NAPI_CloseFile,  main event thread complete.");
     FileAccessHelperCloseFileCB *CloseFileCB = static_cast<FileAccessHelperCloseFileCB *>(data);
     napi_value result = nullptr;
     napi_create_int32(env, CloseFileCB->result, &result);
@@ -1485,12 +1485,12 @@ void CloseFilePromiseCompleteCB(napi_env env, napi_status status, void *data)
     NAPI_CALL_RETURN_VOID(env, napi_delete_async_work(env, CloseFileCB->cbBase.asyncWork));
     delete CloseFileCB;
     CloseFileCB = nullptr;
-    HILOG_INFO("tag dsa NAPI_CloseFile,  main event thread complete end.");
+    HILOG_DEBUG("tag dsa NAPI_CloseFile,  main event thread complete end.");
 }
 
 napi_value NAPI_Release(napi_env env, napi_callback_info info)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     FileAccessHelperReleaseCB *releaseCB = new (std::nothrow) FileAccessHelperReleaseCB;
     if (releaseCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, releaseCB == nullptr.", __func__);
@@ -1507,13 +1507,13 @@ napi_value NAPI_Release(napi_env env, napi_callback_info info)
         releaseCB = nullptr;
         ret = WrapVoidToJS(env);
     }
-    HILOG_INFO("tag dsa %{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,end", __func__);
     return ret;
 }
 
 napi_value ReleaseWrap(napi_env env, napi_callback_info info, FileAccessHelperReleaseCB *releaseCB)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     size_t argcAsync = ARGS_ONE;
     const size_t argcPromise = ARGS_ZERO;
     const size_t argCountWithAsync = argcPromise + ARGS_ASYNC_COUNT;
@@ -1529,7 +1529,7 @@ napi_value ReleaseWrap(napi_env env, napi_callback_info info, FileAccessHelperRe
 
     FileAccessHelper *objectInfo = nullptr;
     napi_unwrap(env, thisVar, (void **)&objectInfo);
-    HILOG_INFO("tag dsa FileAccessHelper ReleaseWrap objectInfo = %{public}p", objectInfo);
+    HILOG_DEBUG("tag dsa FileAccessHelper ReleaseWrap objectInfo = %{public}p", objectInfo);
     releaseCB->fileAccessHelper = objectInfo;
 
     if (argcAsync > argcPromise) {
@@ -1537,13 +1537,13 @@ napi_value ReleaseWrap(napi_env env, napi_callback_info info, FileAccessHelperRe
     } else {
         ret = ReleasePromise(env, releaseCB);
     }
-    HILOG_INFO("tag dsa %{public}s,end", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,end", __func__);
     return ret;
 }
 
 napi_value ReleaseAsync(napi_env env, napi_value *args, const size_t argCallback, FileAccessHelperReleaseCB *releaseCB)
 {
-    HILOG_INFO("tag dsa %{public}s, asyncCallback.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, asyncCallback.", __func__);
     if (args == nullptr || releaseCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, param == nullptr.", __func__);
         return nullptr;
@@ -1568,13 +1568,13 @@ napi_value ReleaseAsync(napi_env env, napi_value *args, const size_t argCallback
     NAPI_CALL(env, napi_queue_async_work(env, releaseCB->cbBase.asyncWork));
     napi_value result = 0;
     NAPI_CALL(env, napi_get_null(env, &result));
-    HILOG_INFO("tag dsa %{public}s, asyncCallback end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, asyncCallback end.", __func__);
     return result;
 }
 
 napi_value ReleasePromise(napi_env env, FileAccessHelperReleaseCB *releaseCB)
 {
-    HILOG_INFO("tag dsa %{public}s, promise.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, promise.", __func__);
     if (releaseCB == nullptr) {
         HILOG_ERROR("tag dsa %{public}s, param == nullptr.", __func__);
         return nullptr;
@@ -1595,25 +1595,25 @@ napi_value ReleasePromise(napi_env env, FileAccessHelperReleaseCB *releaseCB)
             (void *)releaseCB,
             &releaseCB->cbBase.asyncWork));
     NAPI_CALL(env, napi_queue_async_work(env, releaseCB->cbBase.asyncWork));
-    HILOG_INFO("tag dsa %{public}s, promise end.", __func__);
+    HILOG_DEBUG("tag dsa %{public}s, promise end.", __func__);
     return promise;
 }
 
 void ReleaseExecuteCB(napi_env env, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_Release, worker pool thread execute.");
+    HILOG_DEBUG("tag dsa NAPI_Release, worker pool thread execute.");
     FileAccessHelperReleaseCB *releaseCB = static_cast<FileAccessHelperReleaseCB *>(data);
     if (releaseCB->fileAccessHelper != nullptr) {
         releaseCB->result = releaseCB->fileAccessHelper->Release();
     } else {
         HILOG_ERROR("tag dsa NAPI_Release, fileAccessHelper == nullptr");
     }
-    HILOG_INFO("tag dsa NAPI_Release, worker pool thread execute end.");
+    HILOG_DEBUG("tag dsa NAPI_Release, worker pool thread execute end.");
 }
 
 void ReleaseAsyncCompleteCB(napi_env env, napi_status status, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_Release, main event thread complete.");
+    HILOG_DEBUG("tag dsa NAPI_Release, main event thread complete.");
     FileAccessHelperReleaseCB *releaseCB = static_cast<FileAccessHelperReleaseCB *>(data);
     napi_value callback = nullptr;
     napi_value undefined = nullptr;
@@ -1632,12 +1632,12 @@ void ReleaseAsyncCompleteCB(napi_env env, napi_status status, void *data)
     NAPI_CALL_RETURN_VOID(env, napi_delete_async_work(env, releaseCB->cbBase.asyncWork));
     delete releaseCB;
     releaseCB = nullptr;
-    HILOG_INFO("tag dsa NAPI_Release, main event thread complete end.");
+    HILOG_DEBUG("tag dsa NAPI_Release, main event thread complete end.");
 }
 
 void ReleasePromiseCompleteCB(napi_env env, napi_status status, void *data)
 {
-    HILOG_INFO("tag dsa NAPI_Release,  main event thread complete.");
+    HILOG_DEBUG("tag dsa NAPI_Release,  main event thread complete.");
     FileAccessHelperReleaseCB *releaseCB = static_cast<FileAccessHelperReleaseCB *>(data);
     napi_value result = nullptr;
     napi_get_boolean(env, releaseCB->result, &result);
@@ -1645,7 +1645,7 @@ void ReleasePromiseCompleteCB(napi_env env, napi_status status, void *data)
     NAPI_CALL_RETURN_VOID(env, napi_delete_async_work(env, releaseCB->cbBase.asyncWork));
     delete releaseCB;
     releaseCB = nullptr;
-    HILOG_INFO("tag dsa NAPI_Release,  main event thread complete end.");
+    HILOG_DEBUG("tag dsa NAPI_Release,  main event thread complete end.");
 }
 }  // namespace AppExecFwk
 }  // namespace OHOS
\ No newline at end of file
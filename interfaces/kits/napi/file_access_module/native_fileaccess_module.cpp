@@ -31,7 +31,7 @@ EXTERN_C_START
  */
 static napi_value Init(napi_env env, napi_value exports)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     FileAccessHelperInit(env, exports);
     return exports;
 }
@@ -55,7 +55,7 @@ static napi_module _module = {
  */
 extern "C" __attribute__((constructor)) void RegisterModule(void)
 {
-    HILOG_INFO("tag dsa %{public}s,called", __func__);
+    HILOG_DEBUG("tag dsa %{public}s,called", __func__);
     napi_module_register(&_module);
 }
 }
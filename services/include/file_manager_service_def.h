@@ -27,12 +27,34 @@ enum Operation {
     GET_ROOT,
     MAKE_DIR,
     LIST_FILE,
-    CREATE_FILE
+    CREATE_FILE,
+    GET_FOLDER_STATS,
+    CREATE_FILES,
+    BATCH,
+    REGISTER_OBSERVER,
+    GET_PROVIDERS,
+    OPERATION_BUTT
 };
 
+// ids are stable, they are resolved once by the client and sent in every request code
 enum Equipment {
     INTERNAL_STORAGE,
-    EXTERNAL_STORAGE
+    EXTERNAL_STORAGE,
+    LOCAL_DIRECTORY,
+    EQUIPMENT_BUTT
+};
+
+// device names of the builtin providers in CmdOptions
+constexpr const char *INTERNAL_STORAGE_NAME = "local";
+constexpr const char *EXTERNAL_STORAGE_NAME = "external_storage";
+constexpr const char *LOCAL_DIRECTORY_NAME = "local_directory";
+
+enum ListFileFlag {
+    LIST_FILE_PREFETCH = 1 << 0,
+    // reply the list in the layout of CompactFileListWriter
+    LIST_FILE_COMPACT = 1 << 1,
+    // serve from and fill the listing cache of the client, never sent to the service
+    LIST_FILE_CACHE = 1 << 2
 };
 
 enum VolumeState {
@@ -42,8 +64,14 @@ enum VolumeState {
     EJECTING
 };
 constexpr int64_t MAX_NUM = 200;
+// max file count of one CREATE_FILES request
+constexpr size_t MAX_BATCH_NUM = 1000;
+// max sub request count of one BATCH request
+constexpr uint32_t MAX_BATCH_REQUEST_NUM = 32;
 constexpr int32_t CODE_MASK = 0xff;
 constexpr int32_t EQUIPMENT_SHIFT = 16;
+// request code bit of the async variant, the reply is delivered through IFmsCallback
+constexpr uint32_t ASYNC_REQUEST_FLAG = 1 << 24;
 
 const std::string FISRT_LEVEL_ALBUM = "dataability:///album";
 // use to find out album in the root dir
@@ -59,6 +87,7 @@ const std::string ALBUM_TYPE = "album";
 const std::string FILE_MIME_TYPE = "file/*";
 
 const std::string EXTERNAL_STORAGE_URI = "dataability:///external_storage";
+const std::string LOCAL_DIRECTORY_URI = "dataability:///local_directory";
 const std::string MOUNT_POINT_ROOT = "/mnt/";
 
 constexpr int FILE_MEDIA_TYPE = Media::MediaType::MEDIA_TYPE_FILE;
@@ -86,14 +115,6 @@ const std::unordered_map<int, std::string> MEDIA_TYPE_URI_MAPS = {
     {Media::MediaType::MEDIA_TYPE_VIDEO, Media::MEDIALIBRARY_VIDEO_URI},
     {Media::MediaType::MEDIA_TYPE_FILE,  Media::MEDIALIBRARY_FILE_URI},
 };
-
-#define GET_COLUMN_INDEX_FROM_NAME(result, name, index)                                \
-    do {                                                                               \
-        if (result->GetColumnIndex(name, index) != NativeRdb::E_OK) {                  \
-            ERR_LOG("NativeRdb gets %{public}s index fail", name.c_str());             \
-            return false;                                                              \
-        }                                                                              \
-    } while (0)
 } // namespace FileManagerService
 } // namespace OHOS
 #endif // STORAGE_FILE_MANAGER_SERVICE_DEF_H
@@ -23,6 +23,11 @@ constexpr int32_t E_EMPTYFOLDER = -3;         // folder empty
 constexpr int32_t E_INVALID_OPERCODE = -4;    // not valid oper code
 constexpr int32_t E_CREATE_FAIL = -5;         // create file fail
 constexpr int32_t E_INVALID_FILE_NUMBER = -6;    // file count or offset invalid
+constexpr int32_t E_SERVICE_BUSY = -7;        // request queue full or wait timeout
+constexpr int32_t E_RATE_LIMITED = -8;        // caller sent more requests than its rate limit
+constexpr int32_t E_CLIENT_BUSY = -9;         // client executor queue full
+constexpr int32_t E_SERVICE_DIED = -10;       // service died during the request
+constexpr int32_t E_ERRNO_MIN = E_SERVICE_DIED;    // lowest error code above, keep it on the last one
 } // namespace FileManagerService
 } // namespace OHOS
 #endif // STORAGE_SERVICES_INCLUDE_ERRNO_H
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_FMS_TRACE_H
+#define STORAGE_SERVICES_FMS_TRACE_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <unistd.h>
+
+#include "bytrace.h"
+
+namespace OHOS {
+namespace FileManagerService {
+// the spans of the proxy, the stub and the operators use the tag of FileExtConnection
+constexpr uint64_t FMS_TRACE_TAG = BYTRACE_TAG_DISTRIBUTEDDATA;
+const std::string FMS_REQUEST_TRACE = "fms_request";
+const std::string FMS_ASYNC_TRACE = "fms_async_request";
+
+/**
+ * @brief Id of a request, written by the proxy right after the interface token so the async traces of
+ * the client and the service side of one request carry the same id.
+ */
+inline int32_t NewTraceId()
+{
+    static std::atomic<uint32_t> seq {0};
+    uint32_t id = (static_cast<uint32_t>(getpid()) << 16) ^ (seq.fetch_add(1, std::memory_order_relaxed) + 1);
+    return static_cast<int32_t>(id & 0x7fffffff);
+}
+
+/**
+ * @class FmsAsyncTrace
+ * Async trace of name and traceId for the scope.
+ */
+class FmsAsyncTrace {
+public:
+    FmsAsyncTrace(const std::string &name, int32_t traceId) : name_(name), traceId_(traceId)
+    {
+        StartAsyncTrace(FMS_TRACE_TAG, name_, traceId_);
+    }
+    ~FmsAsyncTrace()
+    {
+        FinishAsyncTrace(FMS_TRACE_TAG, name_, traceId_);
+    }
+private:
+    std::string name_;
+    int32_t traceId_;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_FMS_TRACE_H
@@ -23,14 +23,24 @@
 #define LOG_DOMAIN 0xD00430A
 #define LOG_TAG "FileManagerment:FMS"
 
-#define DEBUG_LOG(fmt, args...) \
-    HILOG_DEBUG(LOG_CORE, "{%{public}s():%{public}d} " fmt, __FUNCTION__, __LINE__, ##args)
-#define ERR_LOG(fmt, args...)  \
-    HILOG_ERROR(LOG_CORE, "{%{public}s():%{public}d} " fmt, __FUNCTION__, __LINE__, ##args)
-#define WARNING_LOG(fmt, args...)  \
-    HILOG_WARN(LOG_CORE, "{%{public}s():%{public}d} " fmt, __FUNCTION__, __LINE__, ##args)
-#define INFO_LOG(fmt, args...)  \
-    HILOG_INFO(LOG_CORE, "{%{public}s():%{public}d} " fmt, __FUNCTION__, __LINE__, ##args)
-#define FATAL_LOG(fmt, args...)  \
-    HILOG_FATAL(LOG_CORE, "{%{public}s():%{public}d} " fmt, __FUNCTION__, __LINE__, ##args)
+// levels below FMS_LOG_MIN_LEVEL are compiled out, the build sets it to LOG_INFO for release
+#ifndef FMS_LOG_MIN_LEVEL
+#define FMS_LOG_MIN_LEVEL LOG_DEBUG
+#endif
+
+#define FMS_LOG_ENABLED(level) ((level) >= (FMS_LOG_MIN_LEVEL) && HiLogIsLoggable(LOG_DOMAIN, LOG_TAG, (level)))
+
+// the arguments are only evaluated when the level is compiled in and enabled at runtime
+#define FMS_LOG(level, func, fmt, args...) \
+    do { \
+        if (FMS_LOG_ENABLED(level)) { \
+            func(LOG_CORE, "{%{public}s():%{public}d} " fmt, __FUNCTION__, __LINE__, ##args); \
+        } \
+    } while (0)
+
+#define DEBUG_LOG(fmt, args...) FMS_LOG(LOG_DEBUG, HILOG_DEBUG, fmt, ##args)
+#define ERR_LOG(fmt, args...) FMS_LOG(LOG_ERROR, HILOG_ERROR, fmt, ##args)
+#define WARNING_LOG(fmt, args...) FMS_LOG(LOG_WARN, HILOG_WARN, fmt, ##args)
+#define INFO_LOG(fmt, args...) FMS_LOG(LOG_INFO, HILOG_INFO, fmt, ##args)
+#define FATAL_LOG(fmt, args...) FMS_LOG(LOG_FATAL, HILOG_FATAL, fmt, ##args)
 #endif // STORAGE_SERIVCE_INCLUDE_LOG_H
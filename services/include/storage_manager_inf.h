@@ -14,6 +14,7 @@
  */
 #ifndef STORAGE_MANAGER_INTERFACE_H
 #define STORAGE_MANAGER_INTERFACE_H
+#include <mutex>
 #include <iservice_registry.h>
 #include <system_ability_definition.h>
 #include "ipc/storage_manager_proxy.h"
@@ -27,10 +28,24 @@ public:
     ~StorageManagerInf() = default;
     static int Connect();
     static std::vector<StorageManager::VolumeExternal> GetAllVolumes();
+    // SUCCESS with an empty volumes when no disk is attached, FAIL when storage manager is unreachable
+    static int GetAllVolumes(std::vector<StorageManager::VolumeExternal> &volumes);
     static bool GetMountedVolumes(std::vector<std::string> &vecRootPath);
     static bool StoragePathValidCheck(const std::string &path);
+    // drop the volume table, called on disk mount and unmount events
+    static void InvalidateVolumes();
 private:
+    class StorageManagerDeathRecipient : public IRemoteObject::DeathRecipient {
+    public:
+        void OnRemoteDied(const wptr<IRemoteObject> &object) override;
+    };
+    static int ConnectLocked();
+    static void OnRemoteDied(const wptr<IRemoteObject> &object);
+    inline static std::mutex mutex_;
     inline static sptr<StorageManager::IStorageManager> storageManager_;
+    inline static sptr<IRemoteObject::DeathRecipient> deathRecipient_;
+    inline static bool volumesValid_ = false;
+    inline static std::vector<StorageManager::VolumeExternal> volumes_;
 };
 } // FileManagerService
 } // OHOS
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_BATCH_REQUEST_H
+#define STORAGE_SERVICES_BATCH_REQUEST_H
+
+#include <string>
+
+#include "cmd_options.h"
+#include "file_manager_service_def.h"
+
+namespace OHOS {
+namespace FileManagerService {
+/**
+ * @class BatchRequest
+ * One sub request of IFmsClient::Batch, supports GET_ROOT, MAKE_DIR, LIST_FILE and CREATE_FILE.
+ */
+class BatchRequest {
+public:
+    BatchRequest(Operation operation, const std::string &type, const std::string &path,
+        const std::string &name, const CmdOptions &option)
+        : operation_(operation), type_(type), path_(path), name_(name), option_(option)
+    {}
+    ~BatchRequest() = default;
+
+    static BatchRequest GetRoot(const CmdOptions &option)
+    {
+        return BatchRequest(Operation::GET_ROOT, "", "", "", option);
+    }
+
+    static BatchRequest Mkdir(const std::string &name, const std::string &path, const CmdOptions &option)
+    {
+        return BatchRequest(Operation::MAKE_DIR, "", path, name, option);
+    }
+
+    static BatchRequest ListFile(const std::string &type, const std::string &path, const CmdOptions &option)
+    {
+        return BatchRequest(Operation::LIST_FILE, type, path, "", option);
+    }
+
+    static BatchRequest CreateFile(const std::string &path, const std::string &fileName, const CmdOptions &option)
+    {
+        return BatchRequest(Operation::CREATE_FILE, "", path, fileName, option);
+    }
+
+    Operation GetOperation() const
+    {
+        return operation_;
+    }
+
+    std::string GetType() const
+    {
+        return type_;
+    }
+
+    std::string GetPath() const
+    {
+        return path_;
+    }
+
+    std::string GetName() const
+    {
+        return name_;
+    }
+
+    CmdOptions GetOption() const
+    {
+        return option_;
+    }
+
+private:
+    Operation operation_;
+    std::string type_;
+    std::string path_;
+    std::string name_;
+    CmdOptions option_;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_BATCH_REQUEST_H
@@ -15,10 +15,12 @@
 #include "file_manager_proxy.h"
 
 #include "cmd_response.h"
+#include "compact_file_list.h"
 #include "file_info.h"
 #include "file_manager_service_def.h"
 #include "file_manager_service_errno.h"
 #include "file_manager_service_stub.h"
+#include "fms_trace.h"
 #include "log.h"
 #include "media_file_utils.h"
 
@@ -26,8 +28,29 @@ using namespace std;
 
 namespace OHOS {
 namespace FileManagerService {
+// interface token and then the trace id of the request
+static int32_t WriteHeader(MessageParcel &data, const std::u16string &descriptor)
+{
+    int32_t traceId = NewTraceId();
+    data.WriteInterfaceToken(descriptor);
+    data.WriteInt32(traceId);
+    return traceId;
+}
+
+// a request the service rejected or failed comes back as the transaction status, the reply is lost then,
+// its error codes pass through, a dead service is told apart for FmsClient to retry and any other status
+// is an ipc error
+static int GetSendRequestErr(int err)
+{
+    if (err == ERR_DEAD_OBJECT) {
+        return E_SERVICE_DIED;
+    }
+    return (err < SUCCESS && err >= E_ERRNO_MIN) ? err : FAIL;
+}
+
 static int GetCmdResponse(MessageParcel &reply, sptr<CmdResponse> &cmdResponse)
 {
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
     cmdResponse = reply.ReadParcelable<CmdResponse>();
     if (cmdResponse == nullptr) {
         ERR_LOG("Unmarshalling cmdResponse fail");
@@ -36,25 +59,180 @@ static int GetCmdResponse(MessageParcel &reply, sptr<CmdResponse> &cmdResponse)
     return cmdResponse->GetErr();
 }
 
+static bool IsCompactListFile(const BatchRequest &request)
+{
+    return request.GetOperation() == Operation::LIST_FILE &&
+        (request.GetOption().GetFlags() & ListFileFlag::LIST_FILE_COMPACT) != 0;
+}
+
+// decode the compact list following cmdResponse into its FileInfo list
+static int ReadCompactFileList(MessageParcel &reply, sptr<CmdResponse> &cmdResponse)
+{
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
+    shared_ptr<CompactFileList> fileList = CompactFileList::ReadFromParcel(reply);
+    if (fileList == nullptr) {
+        return FAIL;
+    }
+    vector<shared_ptr<FileInfo>> fileInfoList = fileList->GetFileInfoList();
+    cmdResponse->SetFileInfoList(fileInfoList);
+    return ERR_NONE;
+}
+
+static sptr<CmdResponse> ReadBatchResponse(MessageParcel &reply, const BatchRequest &request)
+{
+    int32_t err = reply.ReadInt32();
+    uint32_t size = reply.ReadUint32();
+    sptr<CmdResponse> cmdResponse = nullptr;
+    if (size > 0) {
+        const uint8_t *buffer = reply.ReadBuffer(size);
+        if (buffer == nullptr) {
+            ERR_LOG("read batch response fail, size %{public}u", size);
+            return nullptr;
+        }
+        MessageParcel subReply;
+        subReply.WriteBuffer(buffer, size);
+        cmdResponse = subReply.ReadParcelable<CmdResponse>();
+        if (cmdResponse != nullptr && cmdResponse->GetErr() == ERR_NONE && IsCompactListFile(request) &&
+            ReadCompactFileList(subReply, cmdResponse) != ERR_NONE) {
+            cmdResponse->SetErr(FAIL);
+        }
+    }
+    // a sub request without handler replies nothing but the error code
+    if (cmdResponse == nullptr) {
+        cmdResponse = new (std::nothrow) CmdResponse();
+        if (cmdResponse == nullptr) {
+            return nullptr;
+        }
+        cmdResponse->SetErr(err);
+    }
+    return cmdResponse;
+}
+
+static FmsResultFunc GetFileListResultFunc(const FileListCallback &callback, const BatchRequest &request)
+{
+    bool compact = IsCompactListFile(request);
+    return [callback, compact](int32_t err, MessageParcel &reply) {
+        std::vector<std::shared_ptr<FileInfo>> fileRes;
+        sptr<CmdResponse> cmdResponse = nullptr;
+        if (reply.GetDataSize() > 0) {
+            err = GetCmdResponse(reply, cmdResponse);
+        }
+        if (err == ERR_NONE && compact) {
+            err = ReadCompactFileList(reply, cmdResponse);
+        }
+        if (err == ERR_NONE && cmdResponse != nullptr) {
+            fileRes = cmdResponse->GetFileInfoList();
+        }
+        callback(err, fileRes);
+    };
+}
+
 FileManagerProxy::FileManagerProxy(const sptr<IRemoteObject> &impl)
-    : IRemoteProxy<IFileManagerService>(impl) {}
-int FileManagerProxy::GetRoot(const CmdOptions &option, vector<shared_ptr<FileInfo>> &fileRes)
+    : IRemoteProxy<IFileManagerService>(impl), listingCache_(make_shared<ListingCache>()),
+    providerIds_({
+        { INTERNAL_STORAGE_NAME, Equipment::INTERNAL_STORAGE },
+        { EXTERNAL_STORAGE_NAME, Equipment::EXTERNAL_STORAGE },
+        { LOCAL_DIRECTORY_NAME, Equipment::LOCAL_DIRECTORY },
+    }) {}
+
+uint32_t FileManagerProxy::GetCode(Operation operation, const CmdOptions &option)
 {
-    CmdOptions op(option);
-    int code = Operation::GET_ROOT;
-    if (op.GetDevInfo().GetName() == "external_storage") {
-        code = (Equipment::EXTERNAL_STORAGE << EQUIPMENT_SHIFT) | Operation::GET_ROOT;
+    return (static_cast<uint32_t>(GetEquipmentId(option.GetDevInfo().GetName())) << EQUIPMENT_SHIFT) | operation;
+}
+
+int32_t FileManagerProxy::GetEquipmentId(const std::string &devName)
+{
+    bool load = false;
+    {
+        lock_guard<mutex> lock(providerMutex_);
+        auto it = providerIds_.find(devName);
+        if (it != providerIds_.end()) {
+            return it->second;
+        }
+        auto now = chrono::steady_clock::now();
+        if (!providersLoaded_ && now >= providersRetryTime_) {
+            providersRetryTime_ = now + chrono::milliseconds(PROVIDERS_RETRY_MS);
+            load = true;
+        }
     }
+    if (load) {
+        vector<shared_ptr<ProviderInfo>> providerList;
+        GetProviders(providerList);
+        lock_guard<mutex> lock(providerMutex_);
+        auto it = providerIds_.find(devName);
+        if (it != providerIds_.end()) {
+            return it->second;
+        }
+    }
+    // any other device name is the media library, as before the providers were registered
+    return Equipment::INTERNAL_STORAGE;
+}
+
+int FileManagerProxy::GetProviders(std::vector<std::shared_ptr<ProviderInfo>> &providerList)
+{
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
     MessageParcel data;
-    data.WriteInterfaceToken(GetDescriptor());
-    data.WriteString(op.GetDevInfo().GetName());
+    int32_t traceId = WriteHeader(data, GetDescriptor());
+    FmsAsyncTrace requestTrace(FMS_REQUEST_TRACE, traceId);
     MessageParcel reply;
     MessageOption messageOption;
-    int err = Remote()->SendRequest(code, data, reply, messageOption);
+    int err = Remote()->SendRequest(Operation::GET_PROVIDERS, data, reply, messageOption);
     if (err != ERR_NONE) {
-        ERR_LOG("GetRoot inner error send request fail %{public}d", err);
+        ERR_LOG("inner error send request fail %{public}d", err);
+        return GetSendRequestErr(err);
+    }
+    sptr<CmdResponse> cmdResponse;
+    err = GetCmdResponse(reply, cmdResponse);
+    if (err != ERR_NONE) {
+        return err;
+    }
+    providerList.clear();
+    if (!ProviderInfo::UnmarshallingList(reply, providerList)) {
         return FAIL;
     }
+    lock_guard<mutex> lock(providerMutex_);
+    for (const auto &provider : providerList) {
+        providerIds_[provider->GetName()] = provider->GetId();
+    }
+    providersLoaded_ = true;
+    return err;
+}
+
+bool FileManagerProxy::WriteRequestArgs(MessageParcel &data, const BatchRequest &request)
+{
+    CmdOptions op = request.GetOption();
+    switch (request.GetOperation()) {
+        case Operation::GET_ROOT:
+            return data.WriteString(op.GetDevInfo().GetName());
+        case Operation::MAKE_DIR:
+            return data.WriteString(request.GetName()) && data.WriteString(request.GetPath());
+        case Operation::LIST_FILE:
+            return data.WriteString(op.GetDevInfo().GetName()) && data.WriteString(op.GetDevInfo().GetPath()) &&
+                data.WriteString(request.GetType()) && data.WriteString(request.GetPath()) &&
+                data.WriteInt64(op.GetOffset()) && data.WriteInt64(op.GetCount()) &&
+                data.WriteUint32(op.GetFlags() & ~ListFileFlag::LIST_FILE_CACHE);
+        case Operation::CREATE_FILE:
+            return data.WriteString(request.GetName()) && data.WriteString(request.GetPath());
+        default:
+            ERR_LOG("operation %{public}d is not supported", request.GetOperation());
+            return false;
+    }
+}
+
+int FileManagerProxy::GetRoot(const CmdOptions &option, vector<shared_ptr<FileInfo>> &fileRes)
+{
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
+    MessageParcel data;
+    int32_t traceId = WriteHeader(data, GetDescriptor());
+    FmsAsyncTrace requestTrace(FMS_REQUEST_TRACE, traceId);
+    WriteRequestArgs(data, BatchRequest::GetRoot(option));
+    MessageParcel reply;
+    MessageOption messageOption;
+    int err = Remote()->SendRequest(GetCode(Operation::GET_ROOT, option), data, reply, messageOption);
+    if (err != ERR_NONE) {
+        ERR_LOG("GetRoot inner error send request fail %{public}d", err);
+        return GetSendRequestErr(err);
+    }
     sptr<CmdResponse> cmdResponse;
     err = GetCmdResponse(reply, cmdResponse);
     if (err != ERR_NONE) {
@@ -67,21 +245,17 @@ int FileManagerProxy::GetRoot(const CmdOptions &option, vector<shared_ptr<FileIn
 int FileManagerProxy::CreateFile(const std::string &path, const std::string &fileName,
     const CmdOptions &option, std::string &uri)
 {
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
     MessageParcel data;
-    data.WriteInterfaceToken(GetDescriptor());
-    data.WriteString(fileName);
-    data.WriteString(path);
+    int32_t traceId = WriteHeader(data, GetDescriptor());
+    FmsAsyncTrace requestTrace(FMS_REQUEST_TRACE, traceId);
+    WriteRequestArgs(data, BatchRequest::CreateFile(path, fileName, option));
     MessageParcel reply;
     MessageOption messageOption;
-    int code = Operation::CREATE_FILE;
-    CmdOptions op(option);
-    if (op.GetDevInfo().GetName() == "external_storage") {
-        code = (Equipment::EXTERNAL_STORAGE << EQUIPMENT_SHIFT) | Operation::CREATE_FILE;
-    }
-    int err = Remote()->SendRequest(code, data, reply, messageOption);
+    int err = Remote()->SendRequest(GetCode(Operation::CREATE_FILE, option), data, reply, messageOption);
     if (err != ERR_NONE) {
         ERR_LOG("inner error send request fail %{public}d", err);
-        return FAIL;
+        return GetSendRequestErr(err);
     }
     sptr<CmdResponse> cmdResponse;
     err = GetCmdResponse(reply, cmdResponse);
@@ -89,51 +263,65 @@ int FileManagerProxy::CreateFile(const std::string &path, const std::string &fil
         return err;
     }
     uri = cmdResponse->GetUri();
+    listingCache_->Invalidate(GetCode(Operation::CREATE_FILE, option) >> EQUIPMENT_SHIFT, path);
     return err;
 }
 
-IFmsClient *IFmsClient::GetFmsInstance()
+int FileManagerProxy::CreateFiles(const std::string &path, const std::vector<std::string> &fileNames,
+    const CmdOptions &option, std::vector<std::string> &uris, std::vector<int32_t> &errs)
 {
-    auto samgr = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
-    if (samgr == nullptr) {
-        ERR_LOG("samgr object is NULL.");
-        return nullptr;
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
+    MessageParcel data;
+    int32_t traceId = WriteHeader(data, GetDescriptor());
+    FmsAsyncTrace requestTrace(FMS_REQUEST_TRACE, traceId);
+    data.WriteStringVector(fileNames);
+    data.WriteString(path);
+    MessageParcel reply;
+    MessageOption messageOption;
+    int err = Remote()->SendRequest(GetCode(Operation::CREATE_FILES, option), data, reply, messageOption);
+    if (err != ERR_NONE) {
+        ERR_LOG("inner error send request fail %{public}d", err);
+        return GetSendRequestErr(err);
     }
-    sptr<IRemoteObject> object = samgr->GetSystemAbility(FILE_MANAGER_SERVICE_ID);
-    if (object == nullptr) {
-        ERR_LOG("FileManager Service object is NULL.");
-        return nullptr;
+    sptr<CmdResponse> cmdResponse;
+    err = GetCmdResponse(reply, cmdResponse);
+    if (err != ERR_NONE) {
+        return err;
+    }
+    if (!reply.ReadStringVector(&uris) || !reply.ReadInt32Vector(&errs) || uris.size() != fileNames.size() ||
+        errs.size() != fileNames.size()) {
+        ERR_LOG("Unmarshalling create files result fail");
+        return FAIL;
     }
-    static FileManagerProxy proxy = FileManagerProxy(object);
-    return &proxy;
+    listingCache_->Invalidate(GetCode(Operation::CREATE_FILES, option) >> EQUIPMENT_SHIFT, path);
+    return err;
 }
 
 int FileManagerProxy::ListFile(const std::string &type, const std::string &path, const CmdOptions &option,
     std::vector<std::shared_ptr<FileInfo>> &fileRes)
 {
-    CmdOptions op(option);
-    std::string devName(op.GetDevInfo().GetName());
-    std::string devPath(op.GetDevInfo().GetPath());
-    int64_t offset = op.GetOffset();
-    int64_t count = op.GetCount();
+    if ((option.GetFlags() & ListFileFlag::LIST_FILE_CACHE) != 0) {
+        return ListFileCached(type, path, option, fileRes);
+    }
+    if ((option.GetFlags() & ListFileFlag::LIST_FILE_COMPACT) != 0) {
+        shared_ptr<CompactFileList> fileList;
+        int err = ListFileCompact(type, path, option, fileList);
+        if (err == ERR_NONE) {
+            fileRes = fileList->GetFileInfoList();
+        }
+        return err;
+    }
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
     MessageParcel data;
-    data.WriteInterfaceToken(GetDescriptor());
-    data.WriteString(devName);
-    data.WriteString(devPath);
-    data.WriteString(type);
-    data.WriteString(path);
-    data.WriteInt64(offset);
-    data.WriteInt64(count);
+    int32_t traceId = WriteHeader(data, GetDescriptor());
+    FmsAsyncTrace requestTrace(FMS_REQUEST_TRACE, traceId);
+    WriteRequestArgs(data, BatchRequest::ListFile(type, path, option));
     MessageParcel reply;
     MessageOption messageOption;
-    uint32_t code = Operation::LIST_FILE;
-    if (op.GetDevInfo().GetName() == "external_storage") {
-        code = (Equipment::EXTERNAL_STORAGE << EQUIPMENT_SHIFT) | Operation::LIST_FILE;
-    }
-    int err = Remote()->SendRequest(code, data, reply, messageOption);
+    int err = Remote()->SendRequest(GetCode(Operation::LIST_FILE, option), data, reply, messageOption);
     if (err != ERR_NONE) {
         ERR_LOG("inner error send request fail %{public}d", err);
-        return FAIL;
+        return GetSendRequestErr(err);
     }
     sptr<CmdResponse> cmdResponse;
     err = GetCmdResponse(reply, cmdResponse);
@@ -144,21 +332,255 @@ int FileManagerProxy::ListFile(const std::string &type, const std::string &path,
     return err;
 }
 
-int FileManagerProxy::Mkdir(const string &name, const string &path)
+int FileManagerProxy::ListFileCached(const std::string &type, const std::string &path, const CmdOptions &option,
+    std::vector<std::shared_ptr<FileInfo>> &fileRes)
 {
+    CmdOptions op(option);
+    op.SetFlags(op.GetFlags() & ~ListFileFlag::LIST_FILE_CACHE);
+    // without the change notifications a cached listing could go stale unnoticed
+    if (!RegisterObserver()) {
+        return ListFile(type, path, op, fileRes);
+    }
+    int32_t equipmentId = GetCode(Operation::LIST_FILE, op) >> EQUIPMENT_SHIFT;
+    string key = ListingCache::MakeKey(equipmentId, type, path, op.GetOffset(), op.GetCount(), op.GetFlags());
+    if (listingCache_->Get(key, fileRes)) {
+        return ERR_NONE;
+    }
+    uint64_t generation = listingCache_->GetGeneration();
+    int err = ListFile(type, path, op, fileRes);
+    if (err == ERR_NONE) {
+        listingCache_->Put(key, equipmentId, path, fileRes, generation);
+    }
+    return err;
+}
+
+bool FileManagerProxy::RegisterObserver()
+{
+    lock_guard<mutex> lock(observerMutex_);
+    if (observer_ != nullptr) {
+        return true;
+    }
+    auto now = chrono::steady_clock::now();
+    if (now < observerRetryTime_) {
+        return false;
+    }
+    observerRetryTime_ = now + chrono::milliseconds(OBSERVER_RETRY_MS);
+    // the observer only holds the cache, a notification arriving after the proxy is gone is harmless
+    shared_ptr<ListingCache> listingCache = listingCache_;
+    sptr<FmsObserverStub> observer = new (std::nothrow) FmsObserverStub([listingCache](int32_t equipmentId,
+        const std::string &path) {
+        listingCache->Invalidate(equipmentId, path);
+    });
+    if (observer == nullptr) {
+        return false;
+    }
+    MessageParcel data;
+    WriteHeader(data, GetDescriptor());
+    if (!data.WriteRemoteObject(observer->AsObject())) {
+        ERR_LOG("write observer fail");
+        return false;
+    }
+    MessageParcel reply;
+    MessageOption messageOption;
+    int err = Remote()->SendRequest(Operation::REGISTER_OBSERVER, data, reply, messageOption);
+    if (err != ERR_NONE) {
+        ERR_LOG("inner error send request fail %{public}d", err);
+        return false;
+    }
+    reply.ReadInt32(err);
+    if (err != ERR_NONE) {
+        ERR_LOG("register observer fail %{public}d", err);
+        return false;
+    }
+    // changes before the registration are not known, start from an empty cache
+    listingCache_->Clear();
+    observer_ = observer;
+    return true;
+}
+
+int FileManagerProxy::ListFileCompact(const std::string &type, const std::string &path, const CmdOptions &option,
+    std::shared_ptr<CompactFileList> &fileList)
+{
+    CmdOptions op(option);
+    op.SetFlags(op.GetFlags() | ListFileFlag::LIST_FILE_COMPACT);
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
+    MessageParcel data;
+    int32_t traceId = WriteHeader(data, GetDescriptor());
+    FmsAsyncTrace requestTrace(FMS_REQUEST_TRACE, traceId);
+    WriteRequestArgs(data, BatchRequest::ListFile(type, path, op));
+    MessageParcel reply;
+    MessageOption messageOption;
+    int err = Remote()->SendRequest(GetCode(Operation::LIST_FILE, op), data, reply, messageOption);
+    if (err != ERR_NONE) {
+        ERR_LOG("inner error send request fail %{public}d", err);
+        return GetSendRequestErr(err);
+    }
+    sptr<CmdResponse> cmdResponse;
+    err = GetCmdResponse(reply, cmdResponse);
+    if (err != ERR_NONE) {
+        return err;
+    }
+    fileList = CompactFileList::ReadFromParcel(reply);
+    return fileList == nullptr ? FAIL : ERR_NONE;
+}
+
+int FileManagerProxy::GetFolderStats(const std::string &path, const CmdOptions &option, bool groupByType,
+    std::vector<std::shared_ptr<FolderStats>> &statsRes)
+{
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
     MessageParcel data;
-    data.WriteInterfaceToken(GetDescriptor());
-    data.WriteString(name);
+    int32_t traceId = WriteHeader(data, GetDescriptor());
+    FmsAsyncTrace requestTrace(FMS_REQUEST_TRACE, traceId);
     data.WriteString(path);
+    data.WriteBool(groupByType);
     MessageParcel reply;
-    MessageOption option;
-    int err = Remote()->SendRequest(Operation::MAKE_DIR, data, reply, option);
+    MessageOption messageOption;
+    int err = Remote()->SendRequest(GetCode(Operation::GET_FOLDER_STATS, option), data, reply, messageOption);
     if (err != ERR_NONE) {
         ERR_LOG("inner error send request fail %{public}d", err);
+        return GetSendRequestErr(err);
+    }
+    sptr<CmdResponse> cmdResponse;
+    err = GetCmdResponse(reply, cmdResponse);
+    if (err != ERR_NONE) {
+        return err;
+    }
+    if (!FolderStats::UnmarshallingList(reply, statsRes)) {
         return FAIL;
     }
-    reply.ReadInt32(err);
     return err;
 }
+
+int FileManagerProxy::Mkdir(const string &name, const string &path, const CmdOptions &option)
+{
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
+    MessageParcel data;
+    int32_t traceId = WriteHeader(data, GetDescriptor());
+    FmsAsyncTrace requestTrace(FMS_REQUEST_TRACE, traceId);
+    WriteRequestArgs(data, BatchRequest::Mkdir(name, path, option));
+    MessageParcel reply;
+    MessageOption messageOption;
+    uint32_t code = GetCode(Operation::MAKE_DIR, option);
+    int err = Remote()->SendRequest(code, data, reply, messageOption);
+    if (err != ERR_NONE) {
+        ERR_LOG("inner error send request fail %{public}d", err);
+        return GetSendRequestErr(err);
+    }
+    sptr<CmdResponse> cmdResponse;
+    err = GetCmdResponse(reply, cmdResponse);
+    if (err == ERR_NONE) {
+        listingCache_->Invalidate(code >> EQUIPMENT_SHIFT, path);
+    }
+    return err;
+}
+
+int FileManagerProxy::Batch(const std::vector<BatchRequest> &requests, bool stopOnError,
+    std::vector<sptr<CmdResponse>> &responses)
+{
+    if (requests.empty() || requests.size() > MAX_BATCH_REQUEST_NUM) {
+        ERR_LOG("invalid batch request number %{public}zu", requests.size());
+        return E_INVALID_FILE_NUMBER;
+    }
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
+    MessageParcel data;
+    int32_t traceId = WriteHeader(data, GetDescriptor());
+    FmsAsyncTrace requestTrace(FMS_REQUEST_TRACE, traceId);
+    data.WriteBool(stopOnError);
+    data.WriteUint32(requests.size());
+    for (const auto &request : requests) {
+        MessageParcel args;
+        if (!WriteRequestArgs(args, request)) {
+            return E_INVALID_OPERCODE;
+        }
+        size_t size = args.GetDataSize();
+        data.WriteUint32(GetCode(request.GetOperation(), request.GetOption()));
+        data.WriteUint32(size);
+        if (size > 0 && !data.WriteBuffer(reinterpret_cast<const void *>(args.GetData()), size)) {
+            ERR_LOG("write batch request fail, size %{public}zu", size);
+            return FAIL;
+        }
+    }
+    MessageParcel reply;
+    MessageOption messageOption;
+    int err = Remote()->SendRequest(Operation::BATCH, data, reply, messageOption);
+    if (err != ERR_NONE) {
+        ERR_LOG("inner error send request fail %{public}d", err);
+        return GetSendRequestErr(err);
+    }
+    // fewer responses than requests when the server stopped on error
+    uint32_t num = reply.ReadUint32();
+    if (num > requests.size()) {
+        ERR_LOG("invalid batch response number %{public}u", num);
+        return FAIL;
+    }
+    responses.clear();
+    for (uint32_t i = 0; i < num; i++) {
+        sptr<CmdResponse> cmdResponse = ReadBatchResponse(reply, requests[i]);
+        if (cmdResponse == nullptr) {
+            return FAIL;
+        }
+        responses.push_back(cmdResponse);
+        Operation operation = requests[i].GetOperation();
+        if (cmdResponse->GetErr() == ERR_NONE &&
+            (operation == Operation::MAKE_DIR || operation == Operation::CREATE_FILE)) {
+            listingCache_->Invalidate(GetCode(operation, requests[i].GetOption()) >> EQUIPMENT_SHIFT,
+                requests[i].GetPath());
+        }
+        if (err == ERR_NONE && cmdResponse->GetErr() != ERR_NONE) {
+            err = cmdResponse->GetErr();
+        }
+    }
+    return err;
+}
+
+int FileManagerProxy::SendAsyncRequest(const BatchRequest &request, const FmsResultFunc &func)
+{
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
+    MessageParcel data;
+    int32_t traceId = WriteHeader(data, GetDescriptor());
+    // the async trace lasts until the result arrives on the callback
+    sptr<FmsCallbackStub> callback = new (std::nothrow) FmsCallbackStub([func, traceId](int32_t err,
+        MessageParcel &reply) {
+        FinishAsyncTrace(FMS_TRACE_TAG, FMS_ASYNC_TRACE, traceId);
+        func(err, reply);
+    });
+    if (callback == nullptr) {
+        return FAIL;
+    }
+    if (!data.WriteRemoteObject(callback->AsObject()) || !WriteRequestArgs(data, request)) {
+        ERR_LOG("write async request fail");
+        return FAIL;
+    }
+    MessageParcel reply;
+    MessageOption messageOption(MessageOption::TF_ASYNC);
+    uint32_t code = GetCode(request.GetOperation(), request.GetOption()) | ASYNC_REQUEST_FLAG;
+    StartAsyncTrace(FMS_TRACE_TAG, FMS_ASYNC_TRACE, traceId);
+    int err = Remote()->SendRequest(code, data, reply, messageOption);
+    if (err != ERR_NONE) {
+        ERR_LOG("inner error send request fail %{public}d", err);
+        FinishAsyncTrace(FMS_TRACE_TAG, FMS_ASYNC_TRACE, traceId);
+        return GetSendRequestErr(err);
+    }
+    return ERR_NONE;
+}
+
+int FileManagerProxy::ListFileAsync(const std::string &type, const std::string &path, const CmdOptions &option,
+    const FileListCallback &callback)
+{
+    if (callback == nullptr) {
+        return FAIL;
+    }
+    BatchRequest request = BatchRequest::ListFile(type, path, option);
+    return SendAsyncRequest(request, GetFileListResultFunc(callback, request));
+}
+
+int FileManagerProxy::GetRootAsync(const CmdOptions &option, const FileListCallback &callback)
+{
+    if (callback == nullptr) {
+        return FAIL;
+    }
+    BatchRequest request = BatchRequest::GetRoot(option);
+    return SendAsyncRequest(request, GetFileListResultFunc(callback, request));
+}
 } // FileManagerService
 } // namespace OHOS
\ No newline at end of file
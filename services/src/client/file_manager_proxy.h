@@ -15,26 +15,68 @@
 #ifndef STORAGE_FILE_MANAGER_PROXY_H
 #define STORAGE_FILE_MANAGER_PROXY_H
 
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 #include "file_manager_service_stub.h"
+#include "fms_callback.h"
+#include "fms_observer.h"
 #include "ifms_client.h"
 #include "iremote_proxy.h"
 #include "iservice_registry.h"
+#include "listing_cache.h"
 #include "system_ability_definition.h"
 
 namespace OHOS {
 namespace FileManagerService {
+// a failed GET_PROVIDERS is not sent again for unknown device names within this time
+constexpr int64_t PROVIDERS_RETRY_MS = 10000;
+// a failed REGISTER_OBSERVER is not sent again within this time, cached listings fall back to ListFile meanwhile
+constexpr int64_t OBSERVER_RETRY_MS = 10000;
+
 class FileManagerProxy : public IRemoteProxy<IFileManagerService>, public IFmsClient {
 public:
     explicit FileManagerProxy(const sptr<IRemoteObject> &impl);
     virtual ~FileManagerProxy() = default;
-    int Mkdir(const std::string &name, const std::string &path) override;
+    int Mkdir(const std::string &name, const std::string &path, const CmdOptions &option) override;
     int ListFile(const std::string &type, const std::string &path, const CmdOptions &option,
         std::vector<std::shared_ptr<FileInfo>> &fileRes) override;
+    int ListFileCompact(const std::string &type, const std::string &path, const CmdOptions &option,
+        std::shared_ptr<CompactFileList> &fileList) override;
     int CreateFile(const std::string &path, const std::string &fileName,
         const CmdOptions &option, std::string &uri) override;
     int GetRoot(const CmdOptions &option, std::vector<std::shared_ptr<FileInfo>> &fileRes) override;
+    int CreateFiles(const std::string &path, const std::vector<std::string> &fileNames,
+        const CmdOptions &option, std::vector<std::string> &uris, std::vector<int32_t> &errs) override;
+    int GetFolderStats(const std::string &path, const CmdOptions &option, bool groupByType,
+        std::vector<std::shared_ptr<FolderStats>> &statsRes) override;
+    int Batch(const std::vector<BatchRequest> &requests, bool stopOnError,
+        std::vector<sptr<CmdResponse>> &responses) override;
+    int ListFileAsync(const std::string &type, const std::string &path, const CmdOptions &option,
+        const FileListCallback &callback) override;
+    int GetRootAsync(const CmdOptions &option, const FileListCallback &callback) override;
+    int GetProviders(std::vector<std::shared_ptr<ProviderInfo>> &providerList) override;
 private:
+    int ListFileCached(const std::string &type, const std::string &path, const CmdOptions &option,
+        std::vector<std::shared_ptr<FileInfo>> &fileRes);
+    bool RegisterObserver();
+    int SendAsyncRequest(const BatchRequest &request, const FmsResultFunc &func);
+    uint32_t GetCode(Operation operation, const CmdOptions &option);
+    int32_t GetEquipmentId(const std::string &devName);
+    static bool WriteRequestArgs(MessageParcel &data, const BatchRequest &request);
     static inline BrokerDelegator<FileManagerProxy> delegator_;
+    std::shared_ptr<ListingCache> listingCache_;
+    std::mutex observerMutex_;
+    sptr<FmsObserverStub> observer_;
+    std::chrono::steady_clock::time_point observerRetryTime_;
+    std::mutex providerMutex_;
+    // device name to provider id, names other than the builtin ones are resolved by GET_PROVIDERS, which is
+    // sent again after a failure at most once per PROVIDERS_RETRY_MS
+    std::unordered_map<std::string, int32_t> providerIds_;
+    bool providersLoaded_ {false};
+    std::chrono::steady_clock::time_point providersRetryTime_;
 };
 } // namespace FileManagerService
 } // namespace OHOS
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fms_async_client.h"
+
+#include "file_manager_service_errno.h"
+#include "log.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+FmsAsyncClient &FmsAsyncClient::GetInstance()
+{
+    static FmsAsyncClient instance(IFmsClient::GetFmsInstance());
+    return instance;
+}
+
+FmsAsyncClient::FmsAsyncClient(IFmsClient *client, size_t maxTaskNum) : client_(client), maxTaskNum_(maxTaskNum) {}
+
+FmsAsyncClient::~FmsAsyncClient()
+{
+    pool_.Stop();
+}
+
+int FmsAsyncClient::Submit(const function<void()> &task)
+{
+    if (client_ == nullptr) {
+        return FAIL;
+    }
+    // reserve a slot first, the caller is never blocked by a full queue
+    if (pending_.fetch_add(1) >= maxTaskNum_) {
+        pending_--;
+        ERR_LOG("client queue full, %{public}zu requests pending", maxTaskNum_);
+        return E_CLIENT_BUSY;
+    }
+    call_once(startFlag_, [this] {
+        pool_.SetMaxTaskNum(maxTaskNum_);
+        pool_.Start(CLIENT_THREAD_NUM);
+    });
+    pool_.AddTask([this, task] {
+        task();
+        pending_--;
+    });
+    return SUCCESS;
+}
+
+size_t FmsAsyncClient::GetPendingNum() const
+{
+    return pending_.load();
+}
+
+int FmsAsyncClient::GetRoot(const CmdOptions &option, const FileListCallback &callback)
+{
+    if (callback == nullptr) {
+        return FAIL;
+    }
+    return Submit([this, option, callback] {
+        vector<shared_ptr<FileInfo>> fileRes;
+        int err = client_->GetRoot(option, fileRes);
+        callback(err, fileRes);
+    });
+}
+
+int FmsAsyncClient::ListFile(const string &type, const string &path, const CmdOptions &option,
+    const FileListCallback &callback)
+{
+    if (callback == nullptr) {
+        return FAIL;
+    }
+    return Submit([this, type, path, option, callback] {
+        vector<shared_ptr<FileInfo>> fileRes;
+        int err = client_->ListFile(type, path, option, fileRes);
+        callback(err, fileRes);
+    });
+}
+
+int FmsAsyncClient::CreateFile(const string &path, const string &fileName, const CmdOptions &option,
+    const UriCallback &callback)
+{
+    if (callback == nullptr) {
+        return FAIL;
+    }
+    return Submit([this, path, fileName, option, callback] {
+        string uri;
+        int err = client_->CreateFile(path, fileName, option, uri);
+        callback(err, uri);
+    });
+}
+
+int FmsAsyncClient::Mkdir(const string &name, const string &path, const CmdOptions &option,
+    const ErrCallback &callback)
+{
+    if (callback == nullptr) {
+        return FAIL;
+    }
+    return Submit([this, name, path, option, callback] {
+        callback(client_->Mkdir(name, path, option));
+    });
+}
+
+static FileListCallback GetFileListSetter(const shared_ptr<promise<FileListResult>> &result)
+{
+    return [result](int err, const vector<shared_ptr<FileInfo>> &fileRes) {
+        result->set_value({err, fileRes});
+    };
+}
+
+future<FileListResult> FmsAsyncClient::GetRoot(const CmdOptions &option)
+{
+    auto result = make_shared<promise<FileListResult>>();
+    int err = GetRoot(option, GetFileListSetter(result));
+    if (err != SUCCESS) {
+        result->set_value({err, {}});
+    }
+    return result->get_future();
+}
+
+future<FileListResult> FmsAsyncClient::ListFile(const string &type, const string &path, const CmdOptions &option)
+{
+    auto result = make_shared<promise<FileListResult>>();
+    int err = ListFile(type, path, option, GetFileListSetter(result));
+    if (err != SUCCESS) {
+        result->set_value({err, {}});
+    }
+    return result->get_future();
+}
+
+future<UriResult> FmsAsyncClient::CreateFile(const string &path, const string &fileName, const CmdOptions &option)
+{
+    auto result = make_shared<promise<UriResult>>();
+    int err = CreateFile(path, fileName, option, [result](int err, const string &uri) {
+        result->set_value({err, uri});
+    });
+    if (err != SUCCESS) {
+        result->set_value({err, ""});
+    }
+    return result->get_future();
+}
+
+future<int> FmsAsyncClient::Mkdir(const string &name, const string &path, const CmdOptions &option)
+{
+    auto result = make_shared<promise<int>>();
+    int err = Mkdir(name, path, option, [result](int err) {
+        result->set_value(err);
+    });
+    if (err != SUCCESS) {
+        result->set_value(err);
+    }
+    return result->get_future();
+}
+} // namespace FileManagerService
+} // namespace OHOS
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_FMS_ASYNC_CLIENT_H
+#define STORAGE_SERVICES_FMS_ASYNC_CLIENT_H
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "file_manager_service_errno.h"
+#include "ifms_client.h"
+#include "thread_pool.h"
+
+namespace OHOS {
+namespace FileManagerService {
+constexpr int CLIENT_THREAD_NUM = 2;
+constexpr size_t CLIENT_MAX_TASK_NUM = 32;
+
+using UriCallback = std::function<void(int err, const std::string &uri)>;
+using ErrCallback = std::function<void(int err)>;
+
+struct FileListResult {
+    int err {FAIL};
+    std::vector<std::shared_ptr<FileInfo>> fileRes;
+};
+
+struct UriResult {
+    int err {FAIL};
+    std::string uri;
+};
+
+/**
+ * @class FmsAsyncClient
+ * Non blocking front of IFmsClient, requests run on a small executor shared by the process.
+ * Callback variants return E_CLIENT_BUSY without calling back when the queue is full,
+ * futures are then ready at once with that error.
+ */
+class FmsAsyncClient {
+public:
+    static FmsAsyncClient &GetInstance();
+    explicit FmsAsyncClient(IFmsClient *client, size_t maxTaskNum = CLIENT_MAX_TASK_NUM);
+    ~FmsAsyncClient();
+    int GetRoot(const CmdOptions &option, const FileListCallback &callback);
+    int ListFile(const std::string &type, const std::string &path, const CmdOptions &option,
+        const FileListCallback &callback);
+    int CreateFile(const std::string &path, const std::string &fileName, const CmdOptions &option,
+        const UriCallback &callback);
+    int Mkdir(const std::string &name, const std::string &path, const CmdOptions &option,
+        const ErrCallback &callback);
+    std::future<FileListResult> GetRoot(const CmdOptions &option);
+    std::future<FileListResult> ListFile(const std::string &type, const std::string &path,
+        const CmdOptions &option);
+    std::future<UriResult> CreateFile(const std::string &path, const std::string &fileName,
+        const CmdOptions &option);
+    std::future<int> Mkdir(const std::string &name, const std::string &path, const CmdOptions &option);
+    size_t GetPendingNum() const;
+private:
+    int Submit(const std::function<void()> &task);
+
+    IFmsClient *client_;
+    size_t maxTaskNum_;
+    std::atomic<size_t> pending_ {0};
+    std::once_flag startFlag_;
+    ThreadPool pool_ {"FmsClient"};
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_FMS_ASYNC_CLIENT_H
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fms_callback.h"
+
+#include "file_manager_service_errno.h"
+#include "log.h"
+
+namespace OHOS {
+namespace FileManagerService {
+void FmsCallbackStub::OnResult(int32_t err, MessageParcel &reply)
+{
+    if (func_ != nullptr) {
+        func_(err, reply);
+    }
+}
+
+int FmsCallbackStub::OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply,
+    MessageOption &option)
+{
+    if (data.ReadInterfaceToken() != GetDescriptor()) {
+        ERR_LOG("reject error remote request");
+        return FAIL;
+    }
+    if (code != ON_RESULT) {
+        return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
+    }
+    int32_t err = data.ReadInt32();
+    uint32_t size = data.ReadUint32();
+    MessageParcel result;
+    if (size > 0) {
+        const uint8_t *buffer = data.ReadBuffer(size);
+        if (buffer == nullptr) {
+            ERR_LOG("read async result fail, size %{public}u", size);
+            err = FAIL;
+        } else {
+            result.WriteBuffer(buffer, size);
+        }
+    }
+    OnResult(err, result);
+    return SUCCESS;
+}
+
+void FmsCallbackProxy::OnResult(int32_t err, MessageParcel &reply)
+{
+    MessageParcel data;
+    size_t size = reply.GetDataSize();
+    if (!data.WriteInterfaceToken(GetDescriptor()) || !data.WriteInt32(err) || !data.WriteUint32(size)) {
+        ERR_LOG("write async result fail");
+        return;
+    }
+    if (size > 0 && !data.WriteBuffer(reinterpret_cast<const void *>(reply.GetData()), size)) {
+        ERR_LOG("write async result fail, size %{public}zu", size);
+        return;
+    }
+    MessageParcel result;
+    MessageOption option(MessageOption::TF_ASYNC);
+    int ret = Remote()->SendRequest(ON_RESULT, data, result, option);
+    if (ret != ERR_NONE) {
+        ERR_LOG("send async result fail %{public}d", ret);
+    }
+}
+} // namespace FileManagerService
+} // namespace OHOS
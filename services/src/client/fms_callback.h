@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_FMS_CALLBACK_H
+#define STORAGE_SERVICES_FMS_CALLBACK_H
+
+#include <functional>
+
+#include "iremote_broker.h"
+#include "iremote_proxy.h"
+#include "iremote_stub.h"
+#include "message_parcel.h"
+
+namespace OHOS {
+namespace FileManagerService {
+/**
+ * @class IFmsCallback
+ * Result channel of an async request, the service calls OnResult once with the reply it would have
+ * written for the same synchronous request.
+ */
+class IFmsCallback : public IRemoteBroker {
+public:
+    enum {
+        ON_RESULT = 1
+    };
+    DECLARE_INTERFACE_DESCRIPTOR(u"IFmsCallback");
+    virtual void OnResult(int32_t err, MessageParcel &reply) = 0;
+};
+
+using FmsResultFunc = std::function<void(int32_t err, MessageParcel &reply)>;
+
+class FmsCallbackStub : public IRemoteStub<IFmsCallback> {
+public:
+    explicit FmsCallbackStub(const FmsResultFunc &func) : func_(func) {}
+    virtual ~FmsCallbackStub() = default;
+    void OnResult(int32_t err, MessageParcel &reply) override;
+    int OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply,
+        MessageOption &option) override;
+private:
+    FmsResultFunc func_;
+};
+
+class FmsCallbackProxy : public IRemoteProxy<IFmsCallback> {
+public:
+    explicit FmsCallbackProxy(const sptr<IRemoteObject> &impl) : IRemoteProxy<IFmsCallback>(impl) {}
+    virtual ~FmsCallbackProxy() = default;
+    void OnResult(int32_t err, MessageParcel &reply) override;
+private:
+    static inline BrokerDelegator<FmsCallbackProxy> delegator_;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_FMS_CALLBACK_H
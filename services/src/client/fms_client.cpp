@@ -0,0 +1,255 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fms_client.h"
+
+#include "file_manager_service_errno.h"
+#include "iservice_registry.h"
+#include "log.h"
+#include "system_ability_definition.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+IFmsClient *IFmsClient::GetFmsInstance()
+{
+    return &FmsClient::GetInstance();
+}
+
+void FmsLoadCallback::OnLoadSystemAbilitySuccess(int32_t systemAbilityId, const sptr<IRemoteObject> &remoteObject)
+{
+    {
+        lock_guard<mutex> lock(mutex_);
+        done_ = true;
+        object_ = remoteObject;
+    }
+    cv_.notify_all();
+}
+
+void FmsLoadCallback::OnLoadSystemAbilityFail(int32_t systemAbilityId)
+{
+    ERR_LOG("load system ability %{public}d fail", systemAbilityId);
+    {
+        lock_guard<mutex> lock(mutex_);
+        done_ = true;
+    }
+    cv_.notify_all();
+}
+
+sptr<IRemoteObject> FmsLoadCallback::Wait(int32_t timeoutMs)
+{
+    unique_lock<mutex> lock(mutex_);
+    if (!cv_.wait_for(lock, chrono::milliseconds(timeoutMs), [this] { return done_; })) {
+        ERR_LOG("load FileManager Service timeout");
+    }
+    return object_;
+}
+
+FmsClient &FmsClient::GetInstance()
+{
+    static FmsClient instance;
+    return instance;
+}
+
+sptr<IRemoteObject> FmsClient::LoadService()
+{
+    auto samgr = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
+    if (samgr == nullptr) {
+        ERR_LOG("samgr object is NULL.");
+        return nullptr;
+    }
+    sptr<IRemoteObject> object = samgr->CheckSystemAbility(FILE_MANAGER_SERVICE_ID);
+    if (object != nullptr) {
+        return object;
+    }
+    sptr<FmsLoadCallback> callback = new (nothrow) FmsLoadCallback();
+    if (callback == nullptr) {
+        return nullptr;
+    }
+    int32_t ret = samgr->LoadSystemAbility(FILE_MANAGER_SERVICE_ID, callback);
+    if (ret != ERR_OK) {
+        ERR_LOG("load FileManager Service fail %{public}d", ret);
+        return nullptr;
+    }
+    return callback->Wait(LOAD_SA_TIMEOUT_MS);
+}
+
+sptr<FileManagerProxy> FmsClient::GetProxy()
+{
+    unique_lock<mutex> lock(mutex_);
+    // one caller loads the service without the lock, the others wait for its result
+    loadCv_.wait(lock, [this] { return !loading_; });
+    // proxy_ is dropped by the death recipient, the check also covers a death not delivered yet
+    if (proxy_ != nullptr && !proxy_->AsObject()->IsObjectDead()) {
+        return proxy_;
+    }
+    proxy_ = nullptr;
+    loading_ = true;
+    if (deathRecipient_ == nullptr) {
+        deathRecipient_ = new (nothrow) FmsDeathRecipient();
+    }
+    sptr<IRemoteObject::DeathRecipient> deathRecipient = deathRecipient_;
+    auto loader = loader_;
+    lock.unlock();
+
+    sptr<FileManagerProxy> proxy = nullptr;
+    sptr<IRemoteObject> object = (loader != nullptr) ? loader() : LoadService();
+    if (object == nullptr) {
+        ERR_LOG("FileManager Service object is NULL.");
+    } else {
+        if (deathRecipient == nullptr || !object->AddDeathRecipient(deathRecipient)) {
+            ERR_LOG("add FileManager Service death recipient fail");
+        }
+        proxy = new (nothrow) FileManagerProxy(object);
+    }
+
+    lock.lock();
+    proxy_ = proxy;
+    loading_ = false;
+    lock.unlock();
+    loadCv_.notify_all();
+    return proxy;
+}
+
+void FmsClient::OnRemoteDied(const wptr<IRemoteObject> &object)
+{
+    lock_guard<mutex> lock(mutex_);
+    // the listing cache and the change observer go with the proxy, an unloaded service notifies nothing
+    if (proxy_ != nullptr && proxy_->AsObject().GetRefPtr() == object.GetRefPtr()) {
+        proxy_ = nullptr;
+    }
+}
+
+void FmsClient::SetLoader(const function<sptr<IRemoteObject>()> &loader)
+{
+    unique_lock<mutex> lock(mutex_);
+    loadCv_.wait(lock, [this] { return !loading_; });
+    loader_ = loader;
+    proxy_ = nullptr;
+}
+
+void FmsDeathRecipient::OnRemoteDied(const wptr<IRemoteObject> &object)
+{
+    ERR_LOG("FileManager Service died");
+    FmsClient::GetInstance().OnRemoteDied(object);
+}
+
+int FmsClient::Call(bool idempotent, const ProxyFunc &func)
+{
+    sptr<FileManagerProxy> proxy = GetProxy();
+    if (proxy == nullptr) {
+        return FAIL;
+    }
+    int err = func(proxy);
+    // the obituary arrives asynchronously, the status of the send may tell the death before IsObjectDead does
+    if (err == SUCCESS || (err != E_SERVICE_DIED && !proxy->AsObject()->IsObjectDead())) {
+        return err;
+    }
+    OnRemoteDied(proxy->AsObject());
+    // the service died under the request, only a request without side effects may run twice
+    if (!idempotent) {
+        return err;
+    }
+    INFO_LOG("FileManager Service died during the request, retry once");
+    proxy = GetProxy();
+    return proxy == nullptr ? err : func(proxy);
+}
+
+bool FmsClient::IsIdempotent(const vector<BatchRequest> &requests)
+{
+    for (const auto &request : requests) {
+        if (request.GetOperation() != Operation::GET_ROOT && request.GetOperation() != Operation::LIST_FILE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int FmsClient::Mkdir(const string &name, const string &path, const CmdOptions &option)
+{
+    return Call(false, [&](const sptr<FileManagerProxy> &proxy) { return proxy->Mkdir(name, path, option); });
+}
+
+int FmsClient::ListFile(const string &type, const string &path, const CmdOptions &option,
+    vector<shared_ptr<FileInfo>> &fileRes)
+{
+    return Call(true, [&](const sptr<FileManagerProxy> &proxy) {
+        return proxy->ListFile(type, path, option, fileRes);
+    });
+}
+
+int FmsClient::ListFileCompact(const string &type, const string &path, const CmdOptions &option,
+    shared_ptr<CompactFileList> &fileList)
+{
+    return Call(true, [&](const sptr<FileManagerProxy> &proxy) {
+        return proxy->ListFileCompact(type, path, option, fileList);
+    });
+}
+
+int FmsClient::GetRoot(const CmdOptions &option, vector<shared_ptr<FileInfo>> &fileRes)
+{
+    return Call(true, [&](const sptr<FileManagerProxy> &proxy) { return proxy->GetRoot(option, fileRes); });
+}
+
+int FmsClient::CreateFile(const string &path, const string &fileName, const CmdOptions &option, string &uri)
+{
+    return Call(false, [&](const sptr<FileManagerProxy> &proxy) {
+        return proxy->CreateFile(path, fileName, option, uri);
+    });
+}
+
+int FmsClient::CreateFiles(const string &path, const vector<string> &fileNames, const CmdOptions &option,
+    vector<string> &uris, vector<int32_t> &errs)
+{
+    return Call(false, [&](const sptr<FileManagerProxy> &proxy) {
+        return proxy->CreateFiles(path, fileNames, option, uris, errs);
+    });
+}
+
+int FmsClient::GetFolderStats(const string &path, const CmdOptions &option, bool groupByType,
+    vector<shared_ptr<FolderStats>> &statsRes)
+{
+    return Call(true, [&](const sptr<FileManagerProxy> &proxy) {
+        return proxy->GetFolderStats(path, option, groupByType, statsRes);
+    });
+}
+
+int FmsClient::Batch(const vector<BatchRequest> &requests, bool stopOnError, vector<sptr<CmdResponse>> &responses)
+{
+    return Call(IsIdempotent(requests), [&](const sptr<FileManagerProxy> &proxy) {
+        return proxy->Batch(requests, stopOnError, responses);
+    });
+}
+
+// a failed async send never reached the service, the callback is not called for it
+int FmsClient::ListFileAsync(const string &type, const string &path, const CmdOptions &option,
+    const FileListCallback &callback)
+{
+    return Call(true, [&](const sptr<FileManagerProxy> &proxy) {
+        return proxy->ListFileAsync(type, path, option, callback);
+    });
+}
+
+int FmsClient::GetRootAsync(const CmdOptions &option, const FileListCallback &callback)
+{
+    return Call(true, [&](const sptr<FileManagerProxy> &proxy) { return proxy->GetRootAsync(option, callback); });
+}
+
+int FmsClient::GetProviders(vector<shared_ptr<ProviderInfo>> &providerList)
+{
+    return Call(true, [&](const sptr<FileManagerProxy> &proxy) { return proxy->GetProviders(providerList); });
+}
+} // namespace FileManagerService
+} // namespace OHOS
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_FMS_CLIENT_H
+#define STORAGE_SERVICES_FMS_CLIENT_H
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+#include "file_manager_proxy.h"
+#include "ifms_client.h"
+#include "system_ability_load_callback_stub.h"
+
+namespace OHOS {
+namespace FileManagerService {
+constexpr int32_t LOAD_SA_TIMEOUT_MS = 5000;
+
+class FmsLoadCallback : public SystemAbilityLoadCallbackStub {
+public:
+    void OnLoadSystemAbilitySuccess(int32_t systemAbilityId, const sptr<IRemoteObject> &remoteObject) override;
+    void OnLoadSystemAbilityFail(int32_t systemAbilityId) override;
+    sptr<IRemoteObject> Wait(int32_t timeoutMs);
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool done_ {false};
+    sptr<IRemoteObject> object_;
+};
+
+class FmsDeathRecipient : public IRemoteObject::DeathRecipient {
+public:
+    void OnRemoteDied(const wptr<IRemoteObject> &object) override;
+};
+
+/**
+ * @class FmsClient
+ * The IFmsClient handed out by GetFmsInstance. fms_service is loaded through samgr on the first call and
+ * again after it unloaded on idle or crashed, so the handle stays valid for the whole client process.
+ * A read that failed because the service died under it runs once more on the new instance.
+ */
+class FmsClient : public IFmsClient {
+public:
+    static FmsClient &GetInstance();
+    int Mkdir(const std::string &name, const std::string &path, const CmdOptions &option) override;
+    int ListFile(const std::string &type, const std::string &path, const CmdOptions &option,
+        std::vector<std::shared_ptr<FileInfo>> &fileRes) override;
+    int ListFileCompact(const std::string &type, const std::string &path, const CmdOptions &option,
+        std::shared_ptr<CompactFileList> &fileList) override;
+    int GetRoot(const CmdOptions &option, std::vector<std::shared_ptr<FileInfo>> &fileRes) override;
+    int CreateFile(const std::string &path, const std::string &fileName,
+        const CmdOptions &option, std::string &uri) override;
+    int CreateFiles(const std::string &path, const std::vector<std::string> &fileNames,
+        const CmdOptions &option, std::vector<std::string> &uris, std::vector<int32_t> &errs) override;
+    int GetFolderStats(const std::string &path, const CmdOptions &option, bool groupByType,
+        std::vector<std::shared_ptr<FolderStats>> &statsRes) override;
+    int Batch(const std::vector<BatchRequest> &requests, bool stopOnError,
+        std::vector<sptr<CmdResponse>> &responses) override;
+    int ListFileAsync(const std::string &type, const std::string &path, const CmdOptions &option,
+        const FileListCallback &callback) override;
+    int GetRootAsync(const CmdOptions &option, const FileListCallback &callback) override;
+    int GetProviders(std::vector<std::shared_ptr<ProviderInfo>> &providerList) override;
+    void OnRemoteDied(const wptr<IRemoteObject> &object);
+    // load the service by loader instead of samgr, nullptr restores samgr, the current proxy is dropped
+    void SetLoader(const std::function<sptr<IRemoteObject>()> &loader);
+private:
+    using ProxyFunc = std::function<int(const sptr<FileManagerProxy> &proxy)>;
+    FmsClient() = default;
+    ~FmsClient() = default;
+    sptr<FileManagerProxy> GetProxy();
+    int Call(bool idempotent, const ProxyFunc &func);
+    static bool IsIdempotent(const std::vector<BatchRequest> &requests);
+    static sptr<IRemoteObject> LoadService();
+
+    std::mutex mutex_;
+    std::condition_variable loadCv_;
+    bool loading_ {false};
+    std::function<sptr<IRemoteObject>()> loader_;
+    sptr<FileManagerProxy> proxy_;
+    sptr<IRemoteObject::DeathRecipient> deathRecipient_;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_FMS_CLIENT_H
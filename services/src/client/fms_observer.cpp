@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fms_observer.h"
+
+#include "file_manager_service_errno.h"
+#include "log.h"
+
+namespace OHOS {
+namespace FileManagerService {
+void FmsObserverStub::OnChange(int32_t equipmentId, const std::string &path)
+{
+    if (func_ != nullptr) {
+        func_(equipmentId, path);
+    }
+}
+
+int FmsObserverStub::OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply,
+    MessageOption &option)
+{
+    if (data.ReadInterfaceToken() != GetDescriptor()) {
+        ERR_LOG("reject error remote request");
+        return FAIL;
+    }
+    if (code != ON_CHANGE) {
+        return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
+    }
+    int32_t equipmentId = data.ReadInt32();
+    std::string path = data.ReadString();
+    OnChange(equipmentId, path);
+    return SUCCESS;
+}
+
+void FmsObserverProxy::OnChange(int32_t equipmentId, const std::string &path)
+{
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(GetDescriptor()) || !data.WriteInt32(equipmentId) || !data.WriteString(path)) {
+        ERR_LOG("write change notification fail");
+        return;
+    }
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC);
+    int ret = Remote()->SendRequest(ON_CHANGE, data, reply, option);
+    if (ret != ERR_NONE) {
+        ERR_LOG("send change notification fail %{public}d", ret);
+    }
+}
+} // namespace FileManagerService
+} // namespace OHOS
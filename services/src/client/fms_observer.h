@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_FMS_OBSERVER_H
+#define STORAGE_SERVICES_FMS_OBSERVER_H
+
+#include <functional>
+#include <string>
+
+#include "iremote_broker.h"
+#include "iremote_proxy.h"
+#include "iremote_stub.h"
+#include "message_parcel.h"
+
+namespace OHOS {
+namespace FileManagerService {
+/**
+ * @class IFmsObserver
+ * Change channel registered by REGISTER_OBSERVER, the service calls OnChange when listings of equipment
+ * under path may have changed, an empty path means any listing of the equipment.
+ */
+class IFmsObserver : public IRemoteBroker {
+public:
+    enum {
+        ON_CHANGE = 1
+    };
+    DECLARE_INTERFACE_DESCRIPTOR(u"IFmsObserver");
+    virtual void OnChange(int32_t equipmentId, const std::string &path) = 0;
+};
+
+using FmsChangeFunc = std::function<void(int32_t equipmentId, const std::string &path)>;
+
+class FmsObserverStub : public IRemoteStub<IFmsObserver> {
+public:
+    explicit FmsObserverStub(const FmsChangeFunc &func) : func_(func) {}
+    virtual ~FmsObserverStub() = default;
+    void OnChange(int32_t equipmentId, const std::string &path) override;
+    int OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply,
+        MessageOption &option) override;
+private:
+    FmsChangeFunc func_;
+};
+
+class FmsObserverProxy : public IRemoteProxy<IFmsObserver> {
+public:
+    explicit FmsObserverProxy(const sptr<IRemoteObject> &impl) : IRemoteProxy<IFmsObserver>(impl) {}
+    virtual ~FmsObserverProxy() = default;
+    void OnChange(int32_t equipmentId, const std::string &path) override;
+private:
+    static inline BrokerDelegator<FmsObserverProxy> delegator_;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_FMS_OBSERVER_H
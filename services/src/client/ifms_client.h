@@ -14,20 +14,45 @@
  */
 #ifndef STORAGE_IFILE_MANAGER_CLIENT_H
 #define STORAGE_IFILE_MANAGER_CLIENT_H
+#include <functional>
+
+#include "batch_request.h"
 #include "cmd_options.h"
+#include "cmd_response.h"
+#include "compact_file_list.h"
 #include "file_info.h"
+#include "folder_stats.h"
+#include "provider_info.h"
 namespace OHOS {
 namespace FileManagerService {
+using FileListCallback = std::function<void(int err, const std::vector<std::shared_ptr<FileInfo>> &fileRes)>;
+
 class IFmsClient {
 public:
     virtual ~IFmsClient() {}
     static IFmsClient *GetFmsInstance();
-    virtual int Mkdir(const std::string &name, const std::string &path) = 0;
+    virtual int Mkdir(const std::string &name, const std::string &path, const CmdOptions &option) = 0;
     virtual int ListFile(const std::string &type, const std::string &path, const CmdOptions &option,
         std::vector<std::shared_ptr<FileInfo>> &fileRes) = 0;
+    // same as ListFile with LIST_FILE_COMPACT, entries are decoded on the first GetFileInfoList call
+    virtual int ListFileCompact(const std::string &type, const std::string &path, const CmdOptions &option,
+        std::shared_ptr<CompactFileList> &fileList) = 0;
     virtual int GetRoot(const CmdOptions &option, std::vector<std::shared_ptr<FileInfo>> &fileRes) = 0;
     virtual int CreateFile(const std::string &path, const std::string &fileName,
         const CmdOptions &option, std::string &uri) = 0;
+    virtual int CreateFiles(const std::string &path, const std::vector<std::string> &fileNames,
+        const CmdOptions &option, std::vector<std::string> &uris, std::vector<int32_t> &errs) = 0;
+    virtual int GetFolderStats(const std::string &path, const CmdOptions &option, bool groupByType,
+        std::vector<std::shared_ptr<FolderStats>> &statsRes) = 0;
+    // run requests in one transaction, responses[i] holds the result of requests[i]
+    virtual int Batch(const std::vector<BatchRequest> &requests, bool stopOnError,
+        std::vector<sptr<CmdResponse>> &responses) = 0;
+    // async variants return once the request is queued, callback runs later on an ipc thread
+    virtual int ListFileAsync(const std::string &type, const std::string &path, const CmdOptions &option,
+        const FileListCallback &callback) = 0;
+    virtual int GetRootAsync(const CmdOptions &option, const FileListCallback &callback) = 0;
+    // the storage providers of the service, CmdOptions selects one by its device name
+    virtual int GetProviders(std::vector<std::shared_ptr<ProviderInfo>> &providerList) = 0;
 };
 } // namespace FileManagerService {
 } // namespace OHOS
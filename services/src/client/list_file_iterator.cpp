@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "list_file_iterator.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+
+#include "file_manager_service_errno.h"
+#include "log.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+namespace {
+const string TOKEN_PREFIX = "v1:";
+// below the digits of INT64_MAX so stoll does not throw
+constexpr size_t TOKEN_MAX_DIGITS = 18;
+}
+
+ListFileIterator::ListFileIterator(const string &type, const string &path, const CmdOptions &option,
+    int64_t pageSize, FmsAsyncClient &client)
+    : type_(type), path_(path), option_(option), pageSize_(clamp<int64_t>(pageSize, 1, LIST_FILE_MAX_PAGE_SIZE)),
+    client_(client), offset_(option.GetOffset()), requestOffset_(option.GetOffset())
+{
+    Prefetch();
+}
+
+int64_t ListFileIterator::GetPageEnd(int64_t offset) const
+{
+    return (offset > INT64_MAX - pageSize_) ? INT64_MAX : offset + pageSize_;
+}
+
+void ListFileIterator::Prefetch()
+{
+    // keep the requests of one page ahead of the caller, more are issued as the earlier ones are consumed
+    int64_t pageEnd = GetPageEnd(offset_);
+    while (requestOffset_ < pageEnd && requests_.size() < LIST_FILE_MAX_INFLIGHT) {
+        int64_t count = min<int64_t>(MAX_NUM, pageEnd - requestOffset_);
+        CmdOptions op(option_);
+        op.SetOffset(requestOffset_);
+        op.setCount(count);
+        requests_.push_back({requestOffset_, count, client_.ListFile(type_, path_, op)});
+        requestOffset_ += count;
+    }
+}
+
+ListFileIterator::~ListFileIterator()
+{
+    Drop();
+}
+
+void ListFileIterator::Drop()
+{
+    // the requests run on the shared executor, they must not outlive the walk that issued them
+    for (auto &request : requests_) {
+        request.result.wait();
+    }
+    requests_.clear();
+}
+
+void ListFileIterator::Reset(int64_t offset)
+{
+    Drop();
+    offset_ = offset;
+    requestOffset_ = offset;
+}
+
+int ListFileIterator::Next(vector<shared_ptr<FileInfo>> &fileRes)
+{
+    fileRes.clear();
+    if (done_) {
+        return SUCCESS;
+    }
+    // a failed page is requested again from its start, the entries of its earlier requests are not lost
+    int64_t pageStart = offset_;
+    int64_t pageEnd = GetPageEnd(pageStart);
+    while (offset_ < pageEnd && !done_) {
+        Prefetch();
+        Request request = move(requests_.front());
+        requests_.pop_front();
+        FileListResult result = request.result.get();
+        // an empty folder, or one whose size is a multiple of the request size, ends with an empty request
+        if (result.err == E_EMPTYFOLDER) {
+            result.err = SUCCESS;
+            result.fileRes.clear();
+        }
+        if (result.err != SUCCESS) {
+            ERR_LOG("list file at %{public}lld fail %{public}d", (long long)request.offset, result.err);
+            Reset(pageStart);
+            fileRes.clear();
+            return result.err;
+        }
+        fileRes.insert(fileRes.end(), result.fileRes.begin(), result.fileRes.end());
+        offset_ = request.offset + static_cast<int64_t>(result.fileRes.size());
+        done_ = static_cast<int64_t>(result.fileRes.size()) < request.count;
+    }
+    if (done_) {
+        Drop();
+    } else {
+        Prefetch();
+    }
+    return SUCCESS;
+}
+
+bool ListFileIterator::HasNext() const
+{
+    return !done_;
+}
+
+string ListFileIterator::GetToken() const
+{
+    return done_ ? "" : TOKEN_PREFIX + to_string(offset_);
+}
+
+bool ListFileIterator::Seek(const string &token)
+{
+    if (token.compare(0, TOKEN_PREFIX.size(), TOKEN_PREFIX) != 0) {
+        return false;
+    }
+    string offset = token.substr(TOKEN_PREFIX.size());
+    if (offset.empty() || offset.size() > TOKEN_MAX_DIGITS || !all_of(offset.begin(), offset.end(), ::isdigit)) {
+        return false;
+    }
+    done_ = false;
+    Reset(stoll(offset));
+    Prefetch();
+    return true;
+}
+} // namespace FileManagerService
+} // namespace OHOS
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_LIST_FILE_ITERATOR_H
+#define STORAGE_SERVICES_LIST_FILE_ITERATOR_H
+
+#include <deque>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "fms_async_client.h"
+
+namespace OHOS {
+namespace FileManagerService {
+constexpr int64_t LIST_FILE_MAX_PAGE_SIZE = MAX_NUM * 50;
+// requests of one iterator on the client executor, the executor is shared by the whole process
+constexpr size_t LIST_FILE_MAX_INFLIGHT = 4;
+
+/**
+ * @class ListFileIterator
+ * Walk a whole folder page by page. A page larger than MAX_NUM is split into several ListFile
+ * requests, and the requests of the next page run on the client executor while the caller
+ * works on the current one, at most LIST_FILE_MAX_INFLIGHT of them at a time.
+ */
+class ListFileIterator {
+public:
+    ListFileIterator(const std::string &type, const std::string &path, const CmdOptions &option,
+        int64_t pageSize = MAX_NUM, FmsAsyncClient &client = FmsAsyncClient::GetInstance());
+    ~ListFileIterator();
+    /**
+     * @brief Get the next page, fileRes is empty once the folder is done.
+     * @return SUCCESS or the error of the failed request, Next may be called again to retry it.
+     */
+    int Next(std::vector<std::shared_ptr<FileInfo>> &fileRes);
+    bool HasNext() const;
+    // continuation of the walk, empty once the folder is done
+    std::string GetToken() const;
+    // continue a walk from the token of an earlier iterator over the same folder
+    bool Seek(const std::string &token);
+private:
+    struct Request {
+        int64_t offset {0};
+        int64_t count {0};
+        std::future<FileListResult> result;
+    };
+    void Prefetch();
+    int64_t GetPageEnd(int64_t offset) const;
+    void Reset(int64_t offset);
+    void Drop();
+
+    std::string type_;
+    std::string path_;
+    CmdOptions option_;
+    int64_t pageSize_;
+    FmsAsyncClient &client_;
+    // offset of the first entry not returned yet and of the first entry not requested yet
+    int64_t offset_;
+    int64_t requestOffset_;
+    bool done_ {false};
+    std::deque<Request> requests_;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_LIST_FILE_ITERATOR_H
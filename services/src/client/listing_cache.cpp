@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "listing_cache.h"
+
+#include "file_manager_service_def.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+string ListingCache::MakeKey(int32_t equipmentId, const string &type, const string &path, int64_t offset,
+    int64_t count, uint32_t flags)
+{
+    // the client side flags do not change the listing
+    flags &= ~(ListFileFlag::LIST_FILE_CACHE | ListFileFlag::LIST_FILE_COMPACT);
+    return to_string(equipmentId) + "|" + type + "|" + path + "|" + to_string(offset) + "|" +
+        to_string(count) + "|" + to_string(flags);
+}
+
+bool ListingCache::Get(const string &key, vector<shared_ptr<FileInfo>> &fileRes)
+{
+    return Get(key, fileRes, chrono::steady_clock::now());
+}
+
+bool ListingCache::Get(const string &key, vector<shared_ptr<FileInfo>> &fileRes, chrono::steady_clock::time_point now)
+{
+    lock_guard<mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        return false;
+    }
+    if (now > it->second->expireTime) {
+        lruList_.erase(it->second);
+        index_.erase(it);
+        return false;
+    }
+    lruList_.splice(lruList_.begin(), lruList_, it->second);
+    fileRes = it->second->fileRes;
+    return true;
+}
+
+void ListingCache::Put(const string &key, int32_t equipmentId, const string &path,
+    const vector<shared_ptr<FileInfo>> &fileRes, uint64_t generation)
+{
+    lock_guard<mutex> lock(mutex_);
+    if (generation != generation_ || capacity_ == 0) {
+        return;
+    }
+    auto expireTime = chrono::steady_clock::now() + ttl_;
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        it->second->fileRes = fileRes;
+        it->second->expireTime = expireTime;
+        lruList_.splice(lruList_.begin(), lruList_, it->second);
+        return;
+    }
+    if (lruList_.size() >= capacity_) {
+        index_.erase(lruList_.back().key);
+        lruList_.pop_back();
+    }
+    lruList_.push_front({key, equipmentId, path, fileRes, expireTime});
+    index_[key] = lruList_.begin();
+}
+
+uint64_t ListingCache::GetGeneration()
+{
+    lock_guard<mutex> lock(mutex_);
+    return generation_;
+}
+
+void ListingCache::Invalidate(int32_t equipmentId, const string &path)
+{
+    lock_guard<mutex> lock(mutex_);
+    generation_++;
+    for (auto it = lruList_.begin(); it != lruList_.end();) {
+        if (it->equipmentId == equipmentId && (path.empty() || it->path == path)) {
+            index_.erase(it->key);
+            it = lruList_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void ListingCache::Clear()
+{
+    lock_guard<mutex> lock(mutex_);
+    generation_++;
+    lruList_.clear();
+    index_.clear();
+}
+
+size_t ListingCache::Size()
+{
+    lock_guard<mutex> lock(mutex_);
+    return lruList_.size();
+}
+} // namespace FileManagerService
+} // namespace OHOS
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_LISTING_CACHE_H
+#define STORAGE_SERVICES_LISTING_CACHE_H
+
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "file_info.h"
+
+namespace OHOS {
+namespace FileManagerService {
+constexpr size_t LISTING_CACHE_CAPACITY = 32;
+// bound for changes the service can not see, e.g. a usb disk written by another device
+constexpr int64_t LISTING_CACHE_TTL_MS = 30000;
+
+/**
+ * @class ListingCache
+ * LRU of ListFile results in the client, kept valid by the change notifications of the service.
+ */
+class ListingCache {
+public:
+    explicit ListingCache(size_t capacity = LISTING_CACHE_CAPACITY, int64_t ttlMs = LISTING_CACHE_TTL_MS)
+        : capacity_(capacity), ttl_(ttlMs) {}
+    ~ListingCache() = default;
+    static std::string MakeKey(int32_t equipmentId, const std::string &type, const std::string &path,
+        int64_t offset, int64_t count, uint32_t flags);
+    bool Get(const std::string &key, std::vector<std::shared_ptr<FileInfo>> &fileRes);
+    bool Get(const std::string &key, std::vector<std::shared_ptr<FileInfo>> &fileRes,
+        std::chrono::steady_clock::time_point now);
+    /**
+     * @brief Put the listing of key.
+     * @param generation Generation read before the request, the entry is dropped if it was invalidated since.
+     */
+    void Put(const std::string &key, int32_t equipmentId, const std::string &path,
+        const std::vector<std::shared_ptr<FileInfo>> &fileRes, uint64_t generation);
+    uint64_t GetGeneration();
+    // drop the listings of equipmentId under path, all of them when path is empty
+    void Invalidate(int32_t equipmentId, const std::string &path);
+    void Clear();
+    size_t Size();
+private:
+    struct Entry {
+        std::string key;
+        int32_t equipmentId {0};
+        std::string path;
+        std::vector<std::shared_ptr<FileInfo>> fileRes;
+        std::chrono::steady_clock::time_point expireTime;
+    };
+    size_t capacity_;
+    std::chrono::milliseconds ttl_;
+    uint64_t generation_ {0};
+    std::mutex mutex_;
+    std::list<Entry> lruList_;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_LISTING_CACHE_H
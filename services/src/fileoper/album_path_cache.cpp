@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "album_path_cache.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+bool AlbumPathCache::Get(const string &id, string &path)
+{
+    lock_guard<mutex> lock(mutex_);
+    auto it = index_.find(id);
+    if (it == index_.end()) {
+        return false;
+    }
+    // move to the head as the most recently used
+    lruList_.splice(lruList_.begin(), lruList_, it->second);
+    path = it->second->second;
+    return true;
+}
+
+void AlbumPathCache::Put(const string &id, const string &path, uint64_t generation)
+{
+    lock_guard<mutex> lock(mutex_);
+    if (generation != generation_ || capacity_ == 0) {
+        return;
+    }
+    auto it = index_.find(id);
+    if (it != index_.end()) {
+        it->second->second = path;
+        lruList_.splice(lruList_.begin(), lruList_, it->second);
+        return;
+    }
+    if (lruList_.size() >= capacity_) {
+        index_.erase(lruList_.back().first);
+        lruList_.pop_back();
+    }
+    lruList_.emplace_front(id, path);
+    index_[id] = lruList_.begin();
+}
+
+uint64_t AlbumPathCache::GetGeneration()
+{
+    lock_guard<mutex> lock(mutex_);
+    return generation_;
+}
+
+void AlbumPathCache::Clear()
+{
+    lock_guard<mutex> lock(mutex_);
+    generation_++;
+    lruList_.clear();
+    index_.clear();
+}
+
+size_t AlbumPathCache::Size()
+{
+    lock_guard<mutex> lock(mutex_);
+    return lruList_.size();
+}
+
+vector<string> AlbumPathCache::GetIds()
+{
+    lock_guard<mutex> lock(mutex_);
+    vector<string> ids;
+    ids.reserve(lruList_.size());
+    for (const auto &entry : lruList_) {
+        ids.push_back(entry.first);
+    }
+    return ids;
+}
+} // namespace FileManagerService
+} // namespace OHOS
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef STORAGE_SERVICES_ALBUM_PATH_CACHE_H
+#define STORAGE_SERVICES_ALBUM_PATH_CACHE_H
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace OHOS {
+namespace FileManagerService {
+constexpr size_t ALBUM_PATH_CACHE_CAPACITY = 128;
+/**
+ * @class AlbumPathCache
+ * LRU map from media album id to the album relative path.
+ */
+class AlbumPathCache {
+public:
+    explicit AlbumPathCache(size_t capacity = ALBUM_PATH_CACHE_CAPACITY) : capacity_(capacity) {}
+    ~AlbumPathCache() = default;
+    bool Get(const std::string &id, std::string &path);
+    /**
+     * @brief Put the path of album id.
+     * @param generation Generation read before the query, the entry is dropped if it was invalidated since.
+     */
+    void Put(const std::string &id, const std::string &path, uint64_t generation);
+    uint64_t GetGeneration();
+    void Clear();
+    size_t Size();
+    // ids from the most to the least recently used
+    std::vector<std::string> GetIds();
+private:
+    using Entry = std::pair<std::string, std::string>;
+    size_t capacity_;
+    uint64_t generation_ {0};
+    std::mutex mutex_;
+    std::list<Entry> lruList_;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_ALBUM_PATH_CACHE_H
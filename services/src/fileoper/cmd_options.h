@@ -120,11 +120,23 @@ public:
         hasOpt_ = hasOpt;
     }
 
+    uint32_t GetFlags() const
+    {
+        return flags_;
+    }
+
+    void SetFlags(uint32_t flags)
+    {
+        flags_ = flags;
+    }
+
 private:
     DevInfo dev_;
     int64_t offset_ {0};
     int64_t count_ {MAX_NUM};
     bool hasOpt_ {false};
+    // ListFileFlag bits
+    uint32_t flags_ {0};
 };
 } // namespace FileManagerService
 } // namespace OHOS
@@ -24,6 +24,9 @@
 #include "parcel.h"
 namespace OHOS {
 namespace FileManagerService {
+// flag written by Parcel::WriteParcelable ahead of a non-null object
+constexpr int32_t PARCELABLE_NOT_NULL = 1;
+
 class CmdResponse : public Parcelable {
 public:
     CmdResponse() = default;
@@ -62,12 +65,20 @@ public:
         return vecFileInfo_;
     }
 
+    /**
+     * @brief Write the fields ahead of the file list, the caller writes fileCount FileInfo parcelables after.
+     */
+    static bool MarshallingHeader(Parcel &parcel, int err, const std::string &uri, size_t fileCount)
+    {
+        parcel.WriteInt32(err);
+        parcel.WriteString(uri);
+        return parcel.WriteUint64(fileCount);
+    }
+
     virtual bool Marshalling(Parcel &parcel) const override
     {
-        parcel.WriteInt32(err_);
-        parcel.WriteString(uri_);
         size_t fileCount = vecFileInfo_.size();
-        parcel.WriteUint64(fileCount);
+        MarshallingHeader(parcel, err_, uri_, fileCount);
         for (size_t i = 0; i < fileCount; i++) {
             if (parcel.WriteParcelable(vecFileInfo_[i].get()) != true) {
                 ERR_LOG("Marshalling FileInfo fails!");
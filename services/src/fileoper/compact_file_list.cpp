@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compact_file_list.h"
+
+#include <algorithm>
+
+#include "fms_trace.h"
+#include "log.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+namespace {
+constexpr int VARINT_SHIFT = 7;
+constexpr uint8_t VARINT_MASK = 0x7f;
+constexpr uint8_t VARINT_MORE = 0x80;
+constexpr int VARINT_MAX_SHIFT = 63;
+constexpr size_t MAX_COMPACT_BYTES = 4 * 1024 * 1024;
+// type, path tag, name length, size and the two time deltas take a byte each at least
+constexpr size_t MIN_ENTRY_BYTES = 6;
+
+void WriteVarint(vector<uint8_t> &bytes, uint64_t value)
+{
+    while (value > VARINT_MASK) {
+        bytes.push_back(static_cast<uint8_t>(value & VARINT_MASK) | VARINT_MORE);
+        value >>= VARINT_SHIFT;
+    }
+    bytes.push_back(static_cast<uint8_t>(value));
+}
+
+uint64_t ZigZagEncode(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> VARINT_MAX_SHIFT);
+}
+
+int64_t ZigZagDecode(uint64_t value)
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+void WriteBytes(vector<uint8_t> &bytes, const string &str)
+{
+    WriteVarint(bytes, str.size());
+    bytes.insert(bytes.end(), str.begin(), str.end());
+}
+
+class VarintReader {
+public:
+    explicit VarintReader(const vector<uint8_t> &bytes) : bytes_(bytes) {}
+    bool Read(uint64_t &value)
+    {
+        value = 0;
+        for (int shift = 0; shift <= VARINT_MAX_SHIFT && pos_ < bytes_.size(); shift += VARINT_SHIFT) {
+            uint8_t byte = bytes_[pos_++];
+            value |= static_cast<uint64_t>(byte & VARINT_MASK) << shift;
+            if ((byte & VARINT_MORE) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+    bool Read(string &str, uint64_t len)
+    {
+        if (len > bytes_.size() - pos_) {
+            return false;
+        }
+        str.assign(reinterpret_cast<const char *>(bytes_.data() + pos_), len);
+        pos_ += len;
+        return true;
+    }
+private:
+    const vector<uint8_t> &bytes_;
+    size_t pos_ {0};
+};
+}
+
+uint32_t CompactFileListWriter::GetTypeIndex(const string &type)
+{
+    // a listing holds few distinct types, a linear search beats hashing
+    uint32_t index = 0;
+    while (index < types_.size() && types_[index] != type) {
+        index++;
+    }
+    if (index == types_.size()) {
+        types_.push_back(type);
+    }
+    return index;
+}
+
+void CompactFileListWriter::Add(const string &path, const string &name, const string &type, int64_t size,
+    int64_t addedTime, int64_t modifiedTime)
+{
+    if (count_ == 0) {
+        size_t pos = path.rfind('/');
+        prefix_ = (pos == string::npos) ? "" : path.substr(0, pos + 1);
+    }
+    WriteVarint(bytes_, GetTypeIndex(type));
+    bool hasPrefix = path.compare(0, prefix_.size(), prefix_) == 0;
+    size_t suffixLen = path.size() - prefix_.size();
+    if (hasPrefix && path.compare(prefix_.size(), suffixLen, name) == 0) {
+        WriteVarint(bytes_, 0);
+    } else if (hasPrefix) {
+        WriteVarint(bytes_, (static_cast<uint64_t>(suffixLen) << 1) + 1);
+        bytes_.insert(bytes_.end(), path.begin() + prefix_.size(), path.end());
+    } else {
+        WriteVarint(bytes_, (static_cast<uint64_t>(path.size()) << 1) + 2);
+        bytes_.insert(bytes_.end(), path.begin(), path.end());
+    }
+    WriteBytes(bytes_, name);
+    WriteVarint(bytes_, ZigZagEncode(size));
+    WriteVarint(bytes_, ZigZagEncode(addedTime - addedTime_));
+    WriteVarint(bytes_, ZigZagEncode(modifiedTime - modifiedTime_));
+    addedTime_ = addedTime;
+    modifiedTime_ = modifiedTime;
+    count_++;
+}
+
+bool CompactFileListWriter::WriteToParcel(Parcel &parcel) const
+{
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
+    if (!parcel.WriteUint32(COMPACT_FILE_LIST_VERSION) || !parcel.WriteUint32(count_) ||
+        !parcel.WriteString(prefix_) || !parcel.WriteStringVector(types_) || !parcel.WriteUint32(bytes_.size())) {
+        return false;
+    }
+    return bytes_.empty() || parcel.WriteBuffer(bytes_.data(), bytes_.size());
+}
+
+shared_ptr<CompactFileList> CompactFileList::ReadFromParcel(Parcel &parcel)
+{
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
+    uint32_t version = parcel.ReadUint32();
+    if (version != COMPACT_FILE_LIST_VERSION) {
+        ERR_LOG("unsupported compact file list version %{public}u", version);
+        return nullptr;
+    }
+    auto fileList = make_shared<CompactFileList>();
+    fileList->count_ = parcel.ReadUint32();
+    fileList->prefix_ = parcel.ReadString();
+    uint32_t size = 0;
+    if (!parcel.ReadStringVector(&fileList->types_) || !parcel.ReadUint32(size) || size > MAX_COMPACT_BYTES) {
+        ERR_LOG("read compact file list fail");
+        return nullptr;
+    }
+    if (size > 0) {
+        const uint8_t *buffer = parcel.ReadBuffer(size);
+        if (buffer == nullptr) {
+            ERR_LOG("read compact file list fail, size %{public}u", size);
+            return nullptr;
+        }
+        fileList->bytes_.assign(buffer, buffer + size);
+    }
+    return fileList;
+}
+
+const vector<shared_ptr<FileInfo>> &CompactFileList::GetFileInfoList()
+{
+    if (!decoded_) {
+        decoded_ = true;
+        if (!Decode()) {
+            ERR_LOG("decode compact file list fail");
+            fileList_.clear();
+        }
+        bytes_.clear();
+        bytes_.shrink_to_fit();
+    }
+    return fileList_;
+}
+
+bool CompactFileList::Decode()
+{
+    VarintReader reader(bytes_);
+    // count comes from the peer, do not reserve more than the bytes can hold
+    fileList_.reserve(min<size_t>(count_, bytes_.size() / MIN_ENTRY_BYTES));
+    int64_t addedTime = 0;
+    int64_t modifiedTime = 0;
+    for (uint32_t i = 0; i < count_; i++) {
+        uint64_t type = 0;
+        uint64_t pathTag = 0;
+        string pathBytes;
+        uint64_t nameLen = 0;
+        string name;
+        if (!reader.Read(type) || type >= types_.size() || !reader.Read(pathTag) ||
+            (pathTag > 0 && !reader.Read(pathBytes, (pathTag - 1) >> 1)) || !reader.Read(nameLen) ||
+            !reader.Read(name, nameLen)) {
+            return false;
+        }
+        uint64_t size = 0;
+        uint64_t addedDelta = 0;
+        uint64_t modifiedDelta = 0;
+        if (!reader.Read(size) || !reader.Read(addedDelta) || !reader.Read(modifiedDelta)) {
+            return false;
+        }
+        addedTime += ZigZagDecode(addedDelta);
+        modifiedTime += ZigZagDecode(modifiedDelta);
+        string path;
+        if (pathTag == 0) {
+            path = prefix_ + name;
+        } else if ((pathTag & 1) != 0) {
+            path = prefix_ + pathBytes;
+        } else {
+            path = move(pathBytes);
+        }
+        auto fileInfo = make_shared<FileInfo>(name, path, types_[type]);
+        fileInfo->SetSize(ZigZagDecode(size));
+        fileInfo->SetAddedTime(addedTime);
+        fileInfo->SetModifiedTime(modifiedTime);
+        fileList_.push_back(fileInfo);
+    }
+    return true;
+}
+} // namespace FileManagerService
+} // namespace OHOS
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_COMPACT_FILE_LIST_H
+#define STORAGE_SERVICES_COMPACT_FILE_LIST_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "file_info.h"
+#include "parcel.h"
+
+namespace OHOS {
+namespace FileManagerService {
+constexpr uint32_t COMPACT_FILE_LIST_VERSION = 2;
+
+/**
+ * Layout of a compact file list, written after a CmdResponse with no FileInfo:
+ *   uint32 version, uint32 count, string prefix, string vector types, uint32 size, size bytes of entries.
+ * Entry is a run of varints: type index, path tag and bytes, name length and the name, size, then added and
+ * modified time as zigzag deltas to the previous entry. Path tag is 0 when the path is prefix + name,
+ * 2 * len + 1 for prefix + len bytes of suffix and 2 * len + 2 for a full path of len bytes.
+ * The prefix is the directory of the first entry, each entry is encoded as it is added.
+ */
+class CompactFileListWriter {
+public:
+    CompactFileListWriter() = default;
+    ~CompactFileListWriter() = default;
+    void Add(const std::string &path, const std::string &name, const std::string &type, int64_t size,
+        int64_t addedTime, int64_t modifiedTime);
+    bool WriteToParcel(Parcel &parcel) const;
+    size_t Count() const
+    {
+        return count_;
+    }
+private:
+    uint32_t GetTypeIndex(const std::string &type);
+
+    uint32_t count_ {0};
+    std::string prefix_;
+    std::vector<std::string> types_;
+    std::vector<uint8_t> bytes_;
+    int64_t addedTime_ {0};
+    int64_t modifiedTime_ {0};
+};
+
+/**
+ * @class CompactFileList
+ * Reader of the compact layout, entries are decoded on the first GetFileInfoList call.
+ */
+class CompactFileList {
+public:
+    CompactFileList() = default;
+    ~CompactFileList() = default;
+    static std::shared_ptr<CompactFileList> ReadFromParcel(Parcel &parcel);
+    size_t Count() const
+    {
+        return count_;
+    }
+    const std::vector<std::shared_ptr<FileInfo>> &GetFileInfoList();
+private:
+    bool Decode();
+
+    uint32_t count_ {0};
+    std::string prefix_;
+    std::vector<std::string> types_;
+    std::vector<uint8_t> bytes_;
+    bool decoded_ {false};
+    std::vector<std::shared_ptr<FileInfo>> fileList_;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_COMPACT_FILE_LIST_H
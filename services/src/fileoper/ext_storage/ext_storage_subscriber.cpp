@@ -20,7 +20,10 @@
 #include "bundle_info.h"
 #include "common_event_manager.h"
 #include "common_event_support.h"
+#include "change_notifier.h"
+#include "file_manager_service_def.h"
 #include "log.h"
+#include "storage_manager_inf.h"
 #include "string_wrapper.h"
 #include "int_wrapper.h"
 #include "want.h"
@@ -43,6 +46,10 @@ bool ExtStorageSubscriber::Subscriber(void)
         EventFwk::MatchingSkills matchingSkills;
         matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_DISK_UNMOUNTED);
         matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_DISK_MOUNTED);
+        // only drop the volume table of StorageManagerInf
+        matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_DISK_REMOVED);
+        matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_DISK_BAD_REMOVAL);
+        matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_DISK_EJECT);
 
         EventFwk::CommonEventSubscribeInfo subscribeInfo(matchingSkills);
         ExtStorageSubscriber_ = std::make_shared<ExtStorageSubscriber>(subscribeInfo);
@@ -66,7 +73,9 @@ void ExtStorageSubscriber::OnReceiveEvent(const EventFwk::CommonEventData &event
     std::string diskId = AAFwk::String::Unbox(AAFwk::IString::Query(wantParams.GetParam("diskId")));
     DEBUG_LOG("%{public}s, id:%{public}s.", __func__, id.c_str());
     DEBUG_LOG("%{public}s, diskId:%{public}s.", __func__, diskId.c_str());
-    
+    StorageManagerInf::InvalidateVolumes();
+    ChangeNotifier::GetInstance().Notify(Equipment::EXTERNAL_STORAGE, "");
+
     if (action == EventFwk::CommonEventSupport::COMMON_EVENT_DISK_MOUNTED) {
         int32_t volumeState = AAFwk::Integer::Unbox(AAFwk::IInteger::Query(wantParams.GetParam("volumeState")));
         std::string fsUuid = AAFwk::String::Unbox(AAFwk::IString::Query(wantParams.GetParam("fsUuid")));
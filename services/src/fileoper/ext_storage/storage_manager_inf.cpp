@@ -43,7 +43,17 @@ static bool GetMountPointFromPath(const string &path, string &mountPoint)
 
 int StorageManagerInf::Connect()
 {
+    lock_guard<mutex> lock(mutex_);
+    return ConnectLocked();
+}
+
+int StorageManagerInf::ConnectLocked()
+{
+    if (storageManager_ != nullptr && !storageManager_->AsObject()->IsObjectDead()) {
+        return SUCCESS;
+    }
     DEBUG_LOG("StorageManagerConnect::Connect start");
+    volumesValid_ = false;
     auto sam = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
     if (sam == nullptr) {
         ERR_LOG("StorageManagerConnect::Connect samgr == nullptr");
@@ -59,18 +69,62 @@ int StorageManagerInf::Connect()
         ERR_LOG("StorageManagerConnect::Connect service == nullptr");
         return FAIL;
     }
+    if (deathRecipient_ == nullptr) {
+        deathRecipient_ = new (std::nothrow) StorageManagerDeathRecipient();
+    }
+    // without the recipient a restarted storage manager is still found by the IsObjectDead check above
+    if (deathRecipient_ == nullptr || !object->AddDeathRecipient(deathRecipient_)) {
+        ERR_LOG("add storage manager death recipient fail");
+    }
     DEBUG_LOG("StorageManagerConnect::Connect end");
     return SUCCESS;
 }
 
+void StorageManagerInf::OnRemoteDied(const wptr<IRemoteObject> &object)
+{
+    lock_guard<mutex> lock(mutex_);
+    if (storageManager_ != nullptr && storageManager_->AsObject().GetRefPtr() == object.GetRefPtr()) {
+        storageManager_ = nullptr;
+        volumesValid_ = false;
+        volumes_.clear();
+    }
+}
+
+void StorageManagerInf::StorageManagerDeathRecipient::OnRemoteDied(const wptr<IRemoteObject> &object)
+{
+    ERR_LOG("storage manager died");
+    StorageManagerInf::OnRemoteDied(object);
+}
+
 std::vector<StorageManager::VolumeExternal> StorageManagerInf::GetAllVolumes()
 {
-    vector<StorageManager::VolumeExternal> result = {};
-    if (Connect() != SUCCESS) {
+    vector<StorageManager::VolumeExternal> volumes;
+    GetAllVolumes(volumes);
+    return volumes;
+}
+
+int StorageManagerInf::GetAllVolumes(vector<StorageManager::VolumeExternal> &volumes)
+{
+    lock_guard<mutex> lock(mutex_);
+    if (ConnectLocked() != SUCCESS) {
         ERR_LOG("GetTotalSizeOfVolume:Connect error");
-        return result;
+        return FAIL;
     }
-    return storageManager_->GetAllVolumes();
+    // the table stays valid until the next disk event, see ExtStorageSubscriber,
+    // an empty one may come from a failed call and is read again next time
+    if (!volumesValid_) {
+        volumes_ = storageManager_->GetAllVolumes();
+        volumesValid_ = !volumes_.empty();
+    }
+    volumes = volumes_;
+    return SUCCESS;
+}
+
+void StorageManagerInf::InvalidateVolumes()
+{
+    lock_guard<mutex> lock(mutex_);
+    volumesValid_ = false;
+    volumes_.clear();
 }
 
 bool StorageManagerInf::GetMountedVolumes(vector<string> &vecRootPath)
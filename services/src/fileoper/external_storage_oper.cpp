@@ -18,51 +18,73 @@
 #include <vector>
 
 #include "cmd_response.h"
+#include "compact_file_list.h"
 #include "external_storage_utils.h"
 #include "file_info.h"
 #include "file_manager_service_def.h"
 #include "file_manager_service_errno.h"
+#include "fms_trace.h"
+#include "folder_stats.h"
 #include "log.h"
+#include "oper_dispatcher.h"
 
 using namespace std;
 namespace OHOS {
 namespace FileManagerService {
-int ExternalStorageOper::OperProcess(uint32_t code, MessageParcel &data, MessageParcel &reply) const
+const ExternalStorageOper &ExternalStorageOper::GetInstance()
 {
-    DEBUG_LOG("ExternalStorageOper::OperProcess");
-    int errCode = SUCCESS;
-    switch (code) {
-        case Operation::LIST_FILE: {
-            std::string devName = data.ReadString();
-            std::string devPath = data.ReadString();
-            std::string type = data.ReadString();
-            std::string path = data.ReadString();
-            int64_t offset = data.ReadInt64();
-            int64_t count = data.ReadInt64();
-
-            CmdOptions option(devName, devPath, offset, count, true);
-            errCode = this->ListFile(type, path, option, reply);
-            break;
-        }
-        case Operation::CREATE_FILE: {
-            std::string name = data.ReadString();
-            std::string uri = data.ReadString();
-            errCode = this->CreateFile(uri, name, reply);
-            break;
-        }
-        case Operation::GET_ROOT: {
-            string path = data.ReadString();
-            // name for extension
-            string name = "name";
-            errCode = GetRoot(name, path, reply);
-            break;
-        }
-        default: {
-            DEBUG_LOG("not valid code %{public}d.", code);
-            break;
-        }
-    }
-    return errCode;
+    static const ExternalStorageOper instance;
+    return instance;
+}
+
+int ExternalStorageOper::OperProcess(uint32_t code, uint32_t tokenId, MessageParcel &data, MessageParcel &reply) const
+{
+    return OperDispatcher::Dispatch(Equipment::EXTERNAL_STORAGE, code, tokenId, data, reply);
+}
+
+int ExternalStorageOper::HandleListFile(uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    std::string devName = data.ReadString();
+    std::string devPath = data.ReadString();
+    std::string type = data.ReadString();
+    std::string path = data.ReadString();
+    int64_t offset = data.ReadInt64();
+    int64_t count = data.ReadInt64();
+    uint32_t flags = data.ReadUint32();
+
+    CmdOptions option(devName, devPath, offset, count, true);
+    option.SetFlags(flags);
+    return GetInstance().ListFile(type, path, option, reply);
+}
+
+int ExternalStorageOper::HandleCreateFile(uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    std::string name = data.ReadString();
+    std::string uri = data.ReadString();
+    return GetInstance().CreateFile(uri, name, reply);
+}
+
+int ExternalStorageOper::HandleGetRoot(uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    string path = data.ReadString();
+    // name for extension
+    string name = "name";
+    return GetInstance().GetRoot(name, path, reply);
+}
+
+int ExternalStorageOper::HandleGetFolderStats(uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    string path = data.ReadString();
+    bool groupByType = data.ReadBool();
+    return GetInstance().GetFolderStats(path, groupByType, reply);
+}
+
+int ExternalStorageOper::HandleCreateFiles(uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    vector<string> names;
+    data.ReadStringVector(&names);
+    string path = data.ReadString();
+    return GetInstance().CreateFiles(names, path, reply);
 }
 
 int ExternalStorageOper::GetRoot(const std::string &name, const std::string &path, MessageParcel &reply) const
@@ -91,16 +113,60 @@ int ExternalStorageOper::CreateFile(const std::string &uri, const std::string &n
     return ret;
 }
 
+int ExternalStorageOper::CreateFiles(const std::vector<std::string> &names, const std::string &path,
+    MessageParcel &reply) const
+{
+    std::vector<std::string> uris;
+    std::vector<int32_t> errs;
+    int ret = E_INVALID_FILE_NUMBER;
+    if (names.size() <= MAX_BATCH_NUM) {
+        ret = ExternalStorageUtils::DoCreateFiles(path, names, uris, errs);
+    }
+    CmdResponse cmdResponse;
+    cmdResponse.SetErr(ret);
+    if (!reply.WriteParcelable(&cmdResponse) || !reply.WriteStringVector(uris) || !reply.WriteInt32Vector(errs)) {
+        ERR_LOG("reply write err parcel capacity:%{public}zu", reply.GetDataCapacity());
+    }
+    return ret;
+}
+
 int ExternalStorageOper::ListFile(const std::string &type, const std::string &uri, const CmdOptions &option,
     MessageParcel &reply) const
 {
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
     std::vector<std::shared_ptr<FileInfo>> fileList;
     int ret = ExternalStorageUtils::DoListFile(type, uri, option, fileList);
     CmdResponse cmdResponse;
     cmdResponse.SetErr(ret);
-    cmdResponse.SetFileInfoList(fileList);
+    bool compact = (option.GetFlags() & ListFileFlag::LIST_FILE_COMPACT) != 0;
+    if (!compact) {
+        cmdResponse.SetFileInfoList(fileList);
+    }
     if (!reply.WriteParcelable(&cmdResponse)) {
         ERR_LOG("reply write err parcel capacity:%{public}zu", reply.GetDataCapacity());
+        return ret;
+    }
+    if (compact && ret == SUCCESS) {
+        CompactFileListWriter writer;
+        for (const auto &fileInfo : fileList) {
+            writer.Add(fileInfo->GetPath(), fileInfo->GetName(), fileInfo->GetType(), fileInfo->GetSize(),
+                fileInfo->GetAddedTime(), fileInfo->GetModifiedTime());
+        }
+        if (!writer.WriteToParcel(reply)) {
+            ERR_LOG("reply write err parcel capacity:%{public}zu", reply.GetDataCapacity());
+        }
+    }
+    return ret;
+}
+
+int ExternalStorageOper::GetFolderStats(const std::string &path, bool groupByType, MessageParcel &reply) const
+{
+    std::vector<std::shared_ptr<FolderStats>> statsList;
+    int ret = ExternalStorageUtils::DoGetFolderStats(path, groupByType, statsList);
+    CmdResponse cmdResponse;
+    cmdResponse.SetErr(ret);
+    if (!reply.WriteParcelable(&cmdResponse) || !FolderStats::MarshallingList(reply, statsList)) {
+        ERR_LOG("reply write err parcel capacity:%{public}zu", reply.GetDataCapacity());
     }
     return ret;
 }
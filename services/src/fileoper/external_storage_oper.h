@@ -16,6 +16,7 @@
 #define STORAGE_SERIVCES_EXTERNAL_STORAGE_OPER_H
 
 #include <string>
+#include <vector>
 #include "cmd_options.h"
 #include "file_oper.h"
 namespace OHOS {
@@ -24,12 +25,21 @@ class ExternalStorageOper : public FileOper {
 public:
     ExternalStorageOper() = default;
     virtual ~ExternalStorageOper() = default;
-    int OperProcess(uint32_t code, MessageParcel &data, MessageParcel &reply) const override;
+    static const ExternalStorageOper &GetInstance();
+    int OperProcess(uint32_t code, uint32_t tokenId, MessageParcel &data, MessageParcel &reply) const override;
+    // handlers registered in the OperDispatcher table
+    static int HandleGetRoot(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
+    static int HandleListFile(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
+    static int HandleCreateFile(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
+    static int HandleGetFolderStats(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
+    static int HandleCreateFiles(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
 private:
     int CreateFile(const std::string &uri, const std::string &name, MessageParcel &reply) const;
+    int CreateFiles(const std::vector<std::string> &names, const std::string &uri, MessageParcel &reply) const;
     int ListFile(const std::string &type, const std::string &uri, const CmdOptions &option,
         MessageParcel &reply) const;
     int GetRoot(const std::string &name, const std::string &path, MessageParcel &reply) const;
+    int GetFolderStats(const std::string &path, bool groupByType, MessageParcel &reply) const;
 };
 } // namespace FileManagerService
 } // namespace OHOS
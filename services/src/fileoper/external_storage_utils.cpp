@@ -26,6 +26,7 @@
 
 #include "file_manager_service_def.h"
 #include "file_manager_service_errno.h"
+#include "fms_trace.h"
 #include "log.h"
 #include "storage_manager_inf.h"
 using namespace std;
@@ -107,6 +108,7 @@ static bool ConvertUriToAbsolutePath(const std::string &uri, std::string &path)
 int ExternalStorageUtils::DoListFile(const std::string &type, const std::string &uri, const CmdOptions &option,
     std::vector<shared_ptr<FileInfo>> &fileList)
 {
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
     int64_t count = option.GetCount();
     int64_t offset = option.GetOffset();
     if (count < 0 || count > MAX_NUM || offset < 0) {
@@ -188,6 +190,63 @@ int ExternalStorageUtils::DoCreateFile(const std::string &uri, const std::string
     return SUCCESS;
 }
 
+int ExternalStorageUtils::DoCreateFiles(const std::string &uri, const std::vector<std::string> &names,
+    std::vector<std::string> &resultUris, std::vector<int32_t> &errs)
+{
+    resultUris.assign(names.size(), "");
+    errs.assign(names.size(), E_CREATE_FAIL);
+    for (size_t i = 0; i < names.size(); i++) {
+        errs[i] = DoCreateFile(uri, names[i], resultUris[i]);
+    }
+    return SUCCESS;
+}
+
+int ExternalStorageUtils::DoGetFolderStats(const std::string &uri, bool groupByType,
+    std::vector<shared_ptr<FolderStats>> &statsList)
+{
+    std::string path;
+    if (!ConvertUriToAbsolutePath(uri, path)) {
+        ERR_LOG("invalid uri[%{private}s].", uri.c_str());
+        return E_NOEXIST;
+    }
+    return GetDirStats(path, groupByType, statsList);
+}
+
+int ExternalStorageUtils::GetDirStats(const std::string &path, bool groupByType,
+    std::vector<shared_ptr<FolderStats>> &statsList)
+{
+    DIR *dir = opendir(path.c_str());
+    if (!dir) {
+        ERR_LOG("opendir path[%{private}s] fail.", path.c_str());
+        return E_NOEXIST;
+    }
+    // regular files make the totals, directories are only counted as album when grouped
+    FolderStats fileStats(groupByType ? Media::MediaType::MEDIA_TYPE_FILE : ALL_MEDIA_TYPE, 0, 0, 0);
+    FolderStats albumStats(Media::MediaType::MEDIA_TYPE_ALBUM, 0, 0, 0);
+    for (dirent *ent = readdir(dir); ent != nullptr; ent = readdir(dir)) {
+        if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0) {
+            continue;
+        }
+        struct stat st;
+        if (fstatat(dirfd(dir), ent->d_name, &st, AT_SYMLINK_NOFOLLOW) != 0) {
+            continue;
+        }
+        if (S_ISREG(st.st_mode)) {
+            fileStats.Add(1, st.st_size, static_cast<int64_t>(st.st_mtim.tv_sec));
+        } else if (groupByType && S_ISDIR(st.st_mode)) {
+            albumStats.Add(1, 0, static_cast<int64_t>(st.st_mtim.tv_sec));
+        }
+    }
+    closedir(dir);
+    if (!groupByType || fileStats.GetCount() != 0) {
+        statsList.emplace_back(make_shared<FolderStats>(fileStats));
+    }
+    if (albumStats.GetCount() != 0) {
+        statsList.emplace_back(make_shared<FolderStats>(albumStats));
+    }
+    return SUCCESS;
+}
+
 int ExternalStorageUtils::DoGetRoot(const std::string &name, const std::string &path,
     std::vector<shared_ptr<FileInfo>> &fileList)
 {
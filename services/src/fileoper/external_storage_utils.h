@@ -22,6 +22,7 @@
 #include "cmd_options.h"
 #include "file_info.h"
 #include "file_oper.h"
+#include "folder_stats.h"
 
 namespace OHOS {
 namespace FileManagerService {
@@ -32,8 +33,15 @@ public:
     static int DoListFile(const std::string &type, const std::string &uri, const CmdOptions &option,
         std::vector<std::shared_ptr<FileInfo>> &fileList);
     static int DoCreateFile(const std::string &uri, const std::string &name, std::string &resultUri);
+    static int DoCreateFiles(const std::string &uri, const std::vector<std::string> &names,
+        std::vector<std::string> &resultUris, std::vector<int32_t> &errs);
     static int DoGetRoot(const std::string &name, const std::string &path,
         std::vector<std::shared_ptr<FileInfo>> &fileList);
+    static int DoGetFolderStats(const std::string &uri, bool groupByType,
+        std::vector<std::shared_ptr<FolderStats>> &statsList);
+    // stats of the direct children of an absolute directory path
+    static int GetDirStats(const std::string &path, bool groupByType,
+        std::vector<std::shared_ptr<FolderStats>> &statsList);
 };
 } // namespace FileManagerService
 } // namespace OHOS
@@ -20,12 +20,18 @@ namespace OHOS {
 namespace FileManagerService  {
 bool FileInfo::Marshalling(Parcel &parcel) const
 {
-    parcel.WriteString(path_);
-    parcel.WriteString(name_);
-    parcel.WriteString(type_);
-    parcel.WriteInt64(size_);
-    parcel.WriteInt64(addedTime_);
-    parcel.WriteInt64(modifiedTime_);
+    return WriteToParcel(parcel, path_, name_, type_, size_, addedTime_, modifiedTime_);
+}
+
+bool FileInfo::WriteToParcel(Parcel &parcel, const string &path, const string &name, const string &type,
+    int64_t size, int64_t addedTime, int64_t modifiedTime)
+{
+    parcel.WriteString(path);
+    parcel.WriteString(name);
+    parcel.WriteString(type);
+    parcel.WriteInt64(size);
+    parcel.WriteInt64(addedTime);
+    parcel.WriteInt64(modifiedTime);
     return true;
 }
 
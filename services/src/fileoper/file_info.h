@@ -78,6 +78,11 @@ public:
     }
     bool Marshalling(Parcel &parcel) const override;
     static FileInfo* Unmarshalling(Parcel &parcel);
+    /**
+     * @brief Write the fields in the layout of Marshalling without building a FileInfo.
+     */
+    static bool WriteToParcel(Parcel &parcel, const std::string &path, const std::string &name,
+        const std::string &type, int64_t size, int64_t addedTime, int64_t modifiedTime);
 private:
     std::string path_;
     std::string name_;
@@ -23,11 +23,15 @@
 
 namespace OHOS {
 namespace FileManagerService {
+// unmarshal the request from data and put the response into reply, tokenId is the caller of the request
+// captured on the binder thread, IPCSkeleton does not know it on the worker thread of an async request
+using OperHandler = int (*)(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
+
 class FileOper {
 public:
     FileOper() = default;
     virtual ~FileOper() = default;
-    virtual int OperProcess(uint32_t code, MessageParcel &data, MessageParcel &reply) const = 0;
+    virtual int OperProcess(uint32_t code, uint32_t tokenId, MessageParcel &data, MessageParcel &reply) const = 0;
 };
 } // namespace FileManagerService
 } // namespace OHOS
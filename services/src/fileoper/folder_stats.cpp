@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "folder_stats.h"
+#include "log.h"
+using namespace std;
+
+namespace OHOS {
+namespace FileManagerService {
+bool FolderStats::Marshalling(Parcel &parcel) const
+{
+    parcel.WriteInt32(mediaType_);
+    parcel.WriteInt64(count_);
+    parcel.WriteInt64(totalSize_);
+    parcel.WriteInt64(lastModifiedTime_);
+    return true;
+}
+
+bool FolderStats::MarshallingList(Parcel &parcel, const vector<shared_ptr<FolderStats>> &statsList)
+{
+    parcel.WriteUint64(statsList.size());
+    for (auto &stats : statsList) {
+        if (!parcel.WriteParcelable(stats.get())) {
+            ERR_LOG("Marshalling FolderStats fails!");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FolderStats::UnmarshallingList(Parcel &parcel, vector<shared_ptr<FolderStats>> &statsList)
+{
+    size_t statsCount = parcel.ReadUint64();
+    for (size_t i = 0; i < statsCount; i++) {
+        shared_ptr<FolderStats> stats(parcel.ReadParcelable<FolderStats>());
+        if (stats == nullptr) {
+            ERR_LOG("Unmarshalling FolderStats fails!");
+            return false;
+        }
+        statsList.emplace_back(stats);
+    }
+    return true;
+}
+
+FolderStats* FolderStats::Unmarshalling(Parcel &parcel)
+{
+    auto *obj = new (std::nothrow) FolderStats();
+    if (obj == nullptr) {
+        ERR_LOG("Unmarshalling fail");
+        return nullptr;
+    }
+    obj->mediaType_ = parcel.ReadInt32();
+    obj->count_ = parcel.ReadInt64();
+    obj->totalSize_ = parcel.ReadInt64();
+    obj->lastModifiedTime_ = parcel.ReadInt64();
+    return obj;
+}
+} // namespace FileManagerService
+} // namespace OHOS
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef STORAGE_SERVICES_FOLDER_STATS_H
+#define STORAGE_SERVICES_FOLDER_STATS_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "parcel.h"
+
+namespace OHOS {
+namespace FileManagerService {
+// media type of the stats which is not grouped by media type
+constexpr int32_t ALL_MEDIA_TYPE = -1;
+
+class FolderStats : public Parcelable {
+public:
+    FolderStats(int32_t mediaType, int64_t count, int64_t totalSize, int64_t lastModifiedTime)
+        : mediaType_(mediaType), count_(count), totalSize_(totalSize), lastModifiedTime_(lastModifiedTime) {}
+    FolderStats() = default;
+    ~FolderStats() = default;
+
+    int32_t GetMediaType() const
+    {
+        return mediaType_;
+    }
+    int64_t GetCount() const
+    {
+        return count_;
+    }
+    int64_t GetTotalSize() const
+    {
+        return totalSize_;
+    }
+    int64_t GetLastModifiedTime() const
+    {
+        return lastModifiedTime_;
+    }
+    void Add(int64_t count, int64_t size, int64_t modifiedTime)
+    {
+        count_ += count;
+        totalSize_ += size;
+        if (modifiedTime > lastModifiedTime_) {
+            lastModifiedTime_ = modifiedTime;
+        }
+    }
+    bool Marshalling(Parcel &parcel) const override;
+    static FolderStats* Unmarshalling(Parcel &parcel);
+    static bool MarshallingList(Parcel &parcel, const std::vector<std::shared_ptr<FolderStats>> &statsList);
+    static bool UnmarshallingList(Parcel &parcel, std::vector<std::shared_ptr<FolderStats>> &statsList);
+private:
+    int32_t mediaType_ {ALL_MEDIA_TYPE};
+    int64_t count_ {0};
+    int64_t totalSize_ {0};
+    int64_t lastModifiedTime_ {0};
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_FOLDER_STATS_H
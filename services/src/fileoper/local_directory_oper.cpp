@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "local_directory_oper.h"
+
+#include <vector>
+
+#include "cmd_response.h"
+#include "compact_file_list.h"
+#include "file_info.h"
+#include "file_manager_service_def.h"
+#include "file_manager_service_errno.h"
+#include "fms_trace.h"
+#include "local_directory_utils.h"
+#include "log.h"
+#include "oper_dispatcher.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+const LocalDirectoryOper &LocalDirectoryOper::GetInstance()
+{
+    static const LocalDirectoryOper instance;
+    return instance;
+}
+
+int LocalDirectoryOper::OperProcess(uint32_t code, uint32_t tokenId, MessageParcel &data, MessageParcel &reply) const
+{
+    return OperDispatcher::Dispatch(Equipment::LOCAL_DIRECTORY, code, tokenId, data, reply);
+}
+
+int LocalDirectoryOper::HandleGetRoot(uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    // device name, the provider has a single root
+    data.ReadString();
+    return GetInstance().GetRoot(reply);
+}
+
+int LocalDirectoryOper::HandleMkdir(uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    string name = data.ReadString();
+    string uri = data.ReadString();
+    return GetInstance().Mkdir(name, uri, reply);
+}
+
+int LocalDirectoryOper::HandleListFile(uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    string devName = data.ReadString();
+    string devPath = data.ReadString();
+    string type = data.ReadString();
+    string path = data.ReadString();
+    int64_t offset = data.ReadInt64();
+    int64_t count = data.ReadInt64();
+    uint32_t flags = data.ReadUint32();
+
+    CmdOptions option(devName, devPath, offset, count, true);
+    option.SetFlags(flags);
+    return GetInstance().ListFile(type, path, option, reply);
+}
+
+int LocalDirectoryOper::HandleCreateFile(uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    string name = data.ReadString();
+    string uri = data.ReadString();
+    return GetInstance().CreateFile(uri, name, reply);
+}
+
+int LocalDirectoryOper::HandleCreateFiles(uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    vector<string> names;
+    data.ReadStringVector(&names);
+    string path = data.ReadString();
+    return GetInstance().CreateFiles(names, path, reply);
+}
+
+int LocalDirectoryOper::GetRoot(MessageParcel &reply) const
+{
+    vector<shared_ptr<FileInfo>> fileList;
+    int ret = LocalDirectoryUtils::DoGetRoot(fileList);
+    CmdResponse cmdResponse;
+    cmdResponse.SetErr(ret);
+    cmdResponse.SetFileInfoList(fileList);
+    if (!reply.WriteParcelable(&cmdResponse)) {
+        ERR_LOG("reply write err parcel capacity:%{public}zu", reply.GetDataCapacity());
+    }
+    return ret;
+}
+
+int LocalDirectoryOper::ListFile(const string &type, const string &uri, const CmdOptions &option,
+    MessageParcel &reply) const
+{
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
+    vector<shared_ptr<FileInfo>> fileList;
+    int ret = LocalDirectoryUtils::DoListFile(type, uri, option, fileList);
+    CmdResponse cmdResponse;
+    cmdResponse.SetErr(ret);
+    bool compact = (option.GetFlags() & ListFileFlag::LIST_FILE_COMPACT) != 0;
+    if (!compact) {
+        cmdResponse.SetFileInfoList(fileList);
+    }
+    if (!reply.WriteParcelable(&cmdResponse)) {
+        ERR_LOG("reply write err parcel capacity:%{public}zu", reply.GetDataCapacity());
+        return ret;
+    }
+    if (compact && ret == SUCCESS) {
+        CompactFileListWriter writer;
+        for (const auto &fileInfo : fileList) {
+            writer.Add(fileInfo->GetPath(), fileInfo->GetName(), fileInfo->GetType(), fileInfo->GetSize(),
+                fileInfo->GetAddedTime(), fileInfo->GetModifiedTime());
+        }
+        if (!writer.WriteToParcel(reply)) {
+            ERR_LOG("reply write err parcel capacity:%{public}zu", reply.GetDataCapacity());
+        }
+    }
+    return ret;
+}
+
+int LocalDirectoryOper::Mkdir(const string &name, const string &uri, MessageParcel &reply) const
+{
+    int ret = LocalDirectoryUtils::DoMkdir(name, uri);
+    CmdResponse cmdResponse;
+    cmdResponse.SetErr(ret);
+    if (!reply.WriteParcelable(&cmdResponse)) {
+        ERR_LOG("reply write err parcel capacity:%{public}zu", reply.GetDataCapacity());
+    }
+    return ret;
+}
+
+int LocalDirectoryOper::CreateFile(const string &uri, const string &name, MessageParcel &reply) const
+{
+    string resultUri;
+    int ret = LocalDirectoryUtils::DoCreateFile(uri, name, resultUri);
+    CmdResponse cmdResponse;
+    cmdResponse.SetErr(ret);
+    cmdResponse.SetUri(resultUri);
+    if (!reply.WriteParcelable(&cmdResponse)) {
+        ERR_LOG("reply write err parcel capacity:%{public}zu", reply.GetDataCapacity());
+    }
+    return ret;
+}
+
+int LocalDirectoryOper::CreateFiles(const vector<string> &names, const string &uri, MessageParcel &reply) const
+{
+    vector<string> uris;
+    vector<int32_t> errs;
+    int ret = E_INVALID_FILE_NUMBER;
+    if (names.size() <= MAX_BATCH_NUM) {
+        ret = LocalDirectoryUtils::DoCreateFiles(uri, names, uris, errs);
+    }
+    CmdResponse cmdResponse;
+    cmdResponse.SetErr(ret);
+    if (!reply.WriteParcelable(&cmdResponse) || !reply.WriteStringVector(uris) || !reply.WriteInt32Vector(errs)) {
+        ERR_LOG("reply write err parcel capacity:%{public}zu", reply.GetDataCapacity());
+    }
+    return ret;
+}
+} // namespace FileManagerService
+} // namespace OHOS
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_LOCAL_DIRECTORY_OPER_H
+#define STORAGE_SERVICES_LOCAL_DIRECTORY_OPER_H
+
+#include <string>
+#include <vector>
+#include "cmd_options.h"
+#include "file_oper.h"
+namespace OHOS {
+namespace FileManagerService {
+class LocalDirectoryOper : public FileOper {
+public:
+    LocalDirectoryOper() = default;
+    virtual ~LocalDirectoryOper() = default;
+    static const LocalDirectoryOper &GetInstance();
+    int OperProcess(uint32_t code, uint32_t tokenId, MessageParcel &data, MessageParcel &reply) const override;
+    // handlers registered in the OperDispatcher table
+    static int HandleGetRoot(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
+    static int HandleMkdir(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
+    static int HandleListFile(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
+    static int HandleCreateFile(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
+    static int HandleCreateFiles(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
+private:
+    int GetRoot(MessageParcel &reply) const;
+    int ListFile(const std::string &type, const std::string &uri, const CmdOptions &option,
+        MessageParcel &reply) const;
+    int Mkdir(const std::string &name, const std::string &uri, MessageParcel &reply) const;
+    int CreateFile(const std::string &uri, const std::string &name, MessageParcel &reply) const;
+    int CreateFiles(const std::vector<std::string> &names, const std::string &uri, MessageParcel &reply) const;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_LOCAL_DIRECTORY_OPER_H
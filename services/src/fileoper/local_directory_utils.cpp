@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "local_directory_utils.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <dirent.h>
+#include <fcntl.h>
+#include <mutex>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "file_manager_service_def.h"
+#include "file_manager_service_errno.h"
+#include "fms_trace.h"
+#include "log.h"
+#include "parameters.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+namespace {
+const string ROOT_DIR_PARAM = "fms.local_directory.root";
+const string DEFAULT_ROOT_DIR = "";
+constexpr mode_t LOCAL_DIR_MODE = 0771;
+constexpr mode_t LOCAL_FILE_MODE = 0660;
+mutex g_rootMutex;
+bool g_rootLoaded = false;
+string g_rootDir;
+}
+
+string LocalDirectoryUtils::GetRootDir()
+{
+    lock_guard<mutex> lock(g_rootMutex);
+    if (!g_rootLoaded) {
+        g_rootDir = system::GetParameter(ROOT_DIR_PARAM, DEFAULT_ROOT_DIR);
+        g_rootLoaded = true;
+    }
+    return g_rootDir;
+}
+
+void LocalDirectoryUtils::SetRootDir(const string &rootDir)
+{
+    lock_guard<mutex> lock(g_rootMutex);
+    g_rootDir = rootDir;
+    g_rootLoaded = true;
+}
+
+bool LocalDirectoryUtils::IsEnabled()
+{
+    return !GetRootDir().empty();
+}
+
+static bool IsValidName(const string &name)
+{
+    return !name.empty() && name != "." && name != ".." && name.find('/') == string::npos;
+}
+
+// resolve uri to a real path inside the root, a link pointing out of the root is rejected too
+static bool ConvertUriToAbsolutePath(const string &uri, string &path)
+{
+    if (uri.compare(0, LOCAL_DIRECTORY_URI.size(), LOCAL_DIRECTORY_URI) != 0) {
+        ERR_LOG("invalid format uri %{private}s, head check fail", uri.c_str());
+        return false;
+    }
+    char realPath[PATH_MAX + 1] = { 0 };
+    if (realpath(uri.substr(LOCAL_DIRECTORY_URI.size()).c_str(), realPath) == nullptr) {
+        ERR_LOG("untrustPath invalid %{public}d", errno);
+        return false;
+    }
+    char rootPath[PATH_MAX + 1] = { 0 };
+    if (realpath(LocalDirectoryUtils::GetRootDir().c_str(), rootPath) == nullptr) {
+        ERR_LOG("local directory root invalid %{public}d", errno);
+        return false;
+    }
+    path = realPath;
+    string root = rootPath;
+    if (path != root && path.compare(0, root.size() + 1, root + "/") != 0) {
+        ERR_LOG("uri %{private}s is out of the local directory", uri.c_str());
+        return false;
+    }
+    return true;
+}
+
+int LocalDirectoryUtils::DoGetRoot(vector<shared_ptr<FileInfo>> &fileList)
+{
+    string root = GetRootDir();
+    if (mkdir(root.c_str(), LOCAL_DIR_MODE) != 0 && errno != EEXIST) {
+        ERR_LOG("create local directory root fail %{public}d", errno);
+        return FAIL;
+    }
+    fileList.push_back(make_shared<FileInfo>(FILE_ROOT_NAME, LOCAL_DIRECTORY_URI + root, ALBUM_TYPE));
+    return SUCCESS;
+}
+
+int LocalDirectoryUtils::DoListFile(const string &type, const string &uri, const CmdOptions &option,
+    vector<shared_ptr<FileInfo>> &fileList)
+{
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
+    int64_t count = option.GetCount();
+    int64_t offset = option.GetOffset();
+    if (count < 0 || count > MAX_NUM || offset < 0) {
+        ERR_LOG("invalid file count or offset.");
+        return E_INVALID_FILE_NUMBER;
+    }
+    string path;
+    if (!ConvertUriToAbsolutePath(uri, path)) {
+        return E_NOEXIST;
+    }
+    DIR *dir = opendir(path.c_str());
+    if (dir == nullptr) {
+        ERR_LOG("opendir path[%{private}s] fail.", path.c_str());
+        return E_NOEXIST;
+    }
+    vector<string> names;
+    for (dirent *ent = readdir(dir); ent != nullptr; ent = readdir(dir)) {
+        if (IsValidName(ent->d_name)) {
+            names.emplace_back(ent->d_name);
+        }
+    }
+    closedir(dir);
+    sort(names.begin(), names.end());
+    for (size_t i = static_cast<size_t>(min<int64_t>(offset, names.size()));
+        i < names.size() && static_cast<int64_t>(fileList.size()) < count; i++) {
+        string fullPath = path + "/" + names[i];
+        struct stat st;
+        if (lstat(fullPath.c_str(), &st) != 0) {
+            continue;
+        }
+        auto fileInfo = make_shared<FileInfo>(names[i], LOCAL_DIRECTORY_URI + fullPath,
+            S_ISDIR(st.st_mode) ? ALBUM_TYPE : "file");
+        fileInfo->SetSize(st.st_size);
+        fileInfo->SetAddedTime(static_cast<long>(st.st_ctim.tv_sec));
+        fileInfo->SetModifiedTime(static_cast<long>(st.st_mtim.tv_sec));
+        fileList.push_back(fileInfo);
+    }
+    return SUCCESS;
+}
+
+int LocalDirectoryUtils::DoCreateFile(const string &uri, const string &name, string &resultUri)
+{
+    string path;
+    if (!IsValidName(name) || !ConvertUriToAbsolutePath(uri, path)) {
+        return E_NOEXIST;
+    }
+    path.append("/").append(name);
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, LOCAL_FILE_MODE);
+    if (fd == -1) {
+        ERR_LOG("create file[%{private}s] fail %{public}d.", path.c_str(), errno);
+        return E_CREATE_FAIL;
+    }
+    close(fd);
+    resultUri = LOCAL_DIRECTORY_URI + path;
+    return SUCCESS;
+}
+
+int LocalDirectoryUtils::DoCreateFiles(const string &uri, const vector<string> &names,
+    vector<string> &resultUris, vector<int32_t> &errs)
+{
+    resultUris.assign(names.size(), "");
+    errs.assign(names.size(), E_CREATE_FAIL);
+    for (size_t i = 0; i < names.size(); i++) {
+        errs[i] = DoCreateFile(uri, names[i], resultUris[i]);
+    }
+    return SUCCESS;
+}
+
+int LocalDirectoryUtils::DoMkdir(const string &name, const string &uri)
+{
+    string path;
+    if (!IsValidName(name) || !ConvertUriToAbsolutePath(uri, path)) {
+        return E_NOEXIST;
+    }
+    path.append("/").append(name);
+    if (mkdir(path.c_str(), LOCAL_DIR_MODE) != 0) {
+        ERR_LOG("mkdir[%{private}s] fail %{public}d.", path.c_str(), errno);
+        return E_CREATE_FAIL;
+    }
+    return SUCCESS;
+}
+} // namespace FileManagerService
+} // namespace OHOS
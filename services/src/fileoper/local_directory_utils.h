@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_LOCAL_DIRECTORY_UTILS_H
+#define STORAGE_SERVICES_LOCAL_DIRECTORY_UTILS_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cmd_options.h"
+#include "file_info.h"
+
+namespace OHOS {
+namespace FileManagerService {
+/**
+ * @class LocalDirectoryUtils
+ * Plain POSIX provider over one directory tree, it needs neither media library nor storage manager
+ * so tests and benchmarks run it on any Linux. Uris are LOCAL_DIRECTORY_URI followed by an absolute
+ * path which must stay inside the root directory. The provider is disabled while the root is empty,
+ * which is the default of fms.local_directory.root.
+ */
+class LocalDirectoryUtils {
+public:
+    static std::string GetRootDir();
+    static void SetRootDir(const std::string &rootDir);
+    static bool IsEnabled();
+    static int DoGetRoot(std::vector<std::shared_ptr<FileInfo>> &fileList);
+    // entries are sorted by name so offset paging is stable across requests
+    static int DoListFile(const std::string &type, const std::string &uri, const CmdOptions &option,
+        std::vector<std::shared_ptr<FileInfo>> &fileList);
+    static int DoCreateFile(const std::string &uri, const std::string &name, std::string &resultUri);
+    static int DoCreateFiles(const std::string &uri, const std::vector<std::string> &names,
+        std::vector<std::string> &resultUris, std::vector<int32_t> &errs);
+    static int DoMkdir(const std::string &name, const std::string &uri);
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_LOCAL_DIRECTORY_UTILS_H
@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media_change_observer.h"
+
+#include "change_notifier.h"
+#include "file_manager_service_def.h"
+#include "log.h"
+#include "media_file_utils.h"
+
+namespace OHOS {
+namespace FileManagerService {
+void MediaChangeObserver::OnChange()
+{
+    DEBUG_LOG("media library changed");
+    MediaFileUtils::OnMediaChange();
+    ChangeNotifier::GetInstance().Notify(Equipment::INTERNAL_STORAGE, "");
+}
+} // namespace FileManagerService
+} // namespace OHOS
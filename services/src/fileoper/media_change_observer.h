@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef STORAGE_SERVICES_MEDIA_CHANGE_OBSERVER_H
+#define STORAGE_SERVICES_MEDIA_CHANGE_OBSERVER_H
+
+#include "data_ability_observer_stub.h"
+
+namespace OHOS {
+namespace FileManagerService {
+/**
+ * @class MediaChangeObserver
+ * Receive media library change notification and drop the media caches.
+ */
+class MediaChangeObserver : public AAFwk::DataAbilityObserverStub {
+public:
+    MediaChangeObserver() = default;
+    virtual ~MediaChangeObserver() = default;
+    void OnChange() override;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_MEDIA_CHANGE_OBSERVER_H
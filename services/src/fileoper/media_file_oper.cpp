@@ -22,6 +22,9 @@
 #include "file_info.h"
 #include "file_manager_service_def.h"
 #include "file_manager_service_errno.h"
+#include "fms_metrics.h"
+#include "fms_trace.h"
+#include "folder_stats.h"
 #include "ipc_types.h"
 #include "iremote_broker.h"
 #include "iremote_proxy.h"
@@ -29,52 +32,72 @@
 #include "log.h"
 #include "media_data_ability_const.h"
 #include "media_file_utils.h"
+#include "media_prefetcher.h"
+#include "oper_dispatcher.h"
 
 using namespace std;
 
 namespace OHOS {
 namespace FileManagerService {
-int MediaFileOper::OperProcess(uint32_t code, MessageParcel &data, MessageParcel &reply) const
+const MediaFileOper &MediaFileOper::GetInstance()
 {
-    int errCode = SUCCESS;
-    // media process
-    switch (code) {
-        case Operation::MAKE_DIR: {
-            string name = data.ReadString();
-            string path = data.ReadString();
-            errCode = Mkdir(name, path);
-            break;
-        }
-        case Operation::GET_ROOT: {
-            string path = data.ReadString();
-            // name for extension
-            string name = "name";
-            errCode = GetRoot(name, path, reply);
-            break;
-        }
-        case Operation::LIST_FILE: {
-            string devName = data.ReadString();
-            string devPath = data.ReadString();
-            string type = data.ReadString();
-            string path = data.ReadString();
-            int off = data.ReadInt64();
-            int count = data.ReadInt64();
-            // put fileInfo into reply
-            errCode = ListFile(type, path, off, count, reply);
-            break;
-        }
-        case Operation::CREATE_FILE: {
-            string name = data.ReadString();
-            string path = data.ReadString();
-            errCode = CreateFile(name, path, reply);
-            break;
-        }
-        default: {
-            DEBUG_LOG("not valid code %{public}u.", code);
-            break;
-        }
-    }
-    return errCode;
+    static const MediaFileOper instance;
+    return instance;
+}
+
+int MediaFileOper::OperProcess(uint32_t code, uint32_t tokenId, MessageParcel &data, MessageParcel &reply) const
+{
+    return OperDispatcher::Dispatch(Equipment::INTERNAL_STORAGE, code, tokenId, data, reply);
+}
+
+int MediaFileOper::HandleMkdir(uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    string name = data.ReadString();
+    string path = data.ReadString();
+    return GetInstance().Mkdir(name, path, reply);
+}
+
+int MediaFileOper::HandleGetRoot(uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    string path = data.ReadString();
+    // name for extension
+    string name = "name";
+    return GetInstance().GetRoot(name, path, reply);
+}
+
+int MediaFileOper::HandleListFile(uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    string devName = data.ReadString();
+    string devPath = data.ReadString();
+    string type = data.ReadString();
+    string path = data.ReadString();
+    int off = data.ReadInt64();
+    int count = data.ReadInt64();
+    uint32_t flags = data.ReadUint32();
+    // put fileInfo into reply
+    return GetInstance().ListFile(tokenId, type, path, off, count, flags, reply);
+}
+
+int MediaFileOper::HandleCreateFile(uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    string name = data.ReadString();
+    string path = data.ReadString();
+    return GetInstance().CreateFile(name, path, reply);
+}
+
+int MediaFileOper::HandleGetFolderStats(uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    string path = data.ReadString();
+    bool groupByType = data.ReadBool();
+    return GetInstance().GetFolderStats(path, groupByType, reply);
+}
+
+int MediaFileOper::HandleCreateFiles(uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    vector<string> names;
+    data.ReadStringVector(&names);
+    string path = data.ReadString();
+    return GetInstance().CreateFiles(names, path, reply);
 }
 
 int MediaFileOper::CreateFile(const std::string &name, const std::string &path, MessageParcel &reply) const
@@ -91,6 +114,23 @@ int MediaFileOper::CreateFile(const std::string &name, const std::string &path,
     return ret;
 }
 
+int MediaFileOper::CreateFiles(const std::vector<std::string> &names, const std::string &path,
+    MessageParcel &reply) const
+{
+    std::vector<std::string> uris;
+    std::vector<int32_t> errs;
+    int ret = E_INVALID_FILE_NUMBER;
+    if (names.size() <= MAX_BATCH_NUM) {
+        ret = MediaFileUtils::DoBatchInsert(names, path, uris, errs);
+    }
+    CmdResponse cmdResponse;
+    cmdResponse.SetErr(ret);
+    if (!reply.WriteParcelable(&cmdResponse) || !reply.WriteStringVector(uris) || !reply.WriteInt32Vector(errs)) {
+        ERR_LOG("reply write err parcel capacity:%{public}zu", reply.GetDataCapacity());
+    }
+    return ret;
+}
+
 int MediaFileOper::GetRoot(const std::string &name, const std::string &path, MessageParcel &reply) const
 {
     std::vector<std::shared_ptr<FileInfo>> fileList;
@@ -104,30 +144,56 @@ int MediaFileOper::GetRoot(const std::string &name, const std::string &path, Mes
     return ret;
 }
 
-int MediaFileOper::ListFile(const string &type, const string &path, int offset, int count, MessageParcel &reply) const
+int MediaFileOper::ListFile(uint32_t tokenId, const string &type, const string &path, int offset, int count,
+    uint32_t flags, MessageParcel &reply) const
 {
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
+    // prefetched pages are kept per caller
+    bool prefetch = (flags & ListFileFlag::LIST_FILE_PREFETCH) != 0;
     shared_ptr<NativeRdb::AbsSharedResultSet> result;
-    int res = MediaFileUtils::DoListFile(type, path, offset, count, result);
-    if (res != SUCCESS) {
-        return res;
+    if (prefetch) {
+        result = MediaPrefetcher::GetInstance().Take(tokenId, type, path, offset, count);
+        FmsMetrics::GetInstance().RecordCache(CACHE_PREFETCH, result != nullptr);
+    }
+    if (result == nullptr) {
+        int res = MediaFileUtils::DoListFile(type, path, offset, count, result);
+        if (res != SUCCESS) {
+            return res;
+        }
+    }
+    int rowCount = 0;
+    result->GetRowCount(rowCount);
+    // a full page means the caller is likely to ask for the next one
+    if (prefetch && count > 0 && rowCount == count) {
+        MediaPrefetcher::GetInstance().Prefetch(tokenId, type, path, offset + count, count);
     }
 
-    std::vector<std::shared_ptr<FileInfo>> fileList;
-    res = MediaFileUtils::GetFileInfoFromResult(result, fileList);
+    // stream the rows into reply instead of building FileInfo list
+    return MediaFileUtils::WriteFileInfoFromResult(result, reply, (flags & ListFileFlag::LIST_FILE_COMPACT) != 0);
+}
+
+int MediaFileOper::GetFolderStats(const std::string &path, bool groupByType, MessageParcel &reply) const
+{
+    std::vector<std::shared_ptr<FolderStats>> statsList;
+    int ret = MediaFileUtils::DoGetFolderStats(path, groupByType, statsList);
     CmdResponse cmdResponse;
-    cmdResponse.SetErr(res);
-    cmdResponse.SetFileInfoList(fileList);
-    if (!reply.WriteParcelable(&cmdResponse)) {
+    cmdResponse.SetErr(ret);
+    if (!reply.WriteParcelable(&cmdResponse) || !FolderStats::MarshallingList(reply, statsList)) {
         ERR_LOG("reply write err parcel capacity:%{public}zu", reply.GetDataCapacity());
     }
-    return res;
+    return ret;
 }
 
-int MediaFileOper::Mkdir(const string &name, const string &path) const
+int MediaFileOper::Mkdir(const string &name, const string &path, MessageParcel &reply) const
 {
-    (void)name;
-    DEBUG_LOG("MediaFileOper::mkdir path %{public}s.", path.c_str());
-    return SUCCESS;
+    DEBUG_LOG("MediaFileOper::mkdir path %{private}s.", path.c_str());
+    int ret = MediaFileUtils::DoMkdir(name, path);
+    CmdResponse cmdResponse;
+    cmdResponse.SetErr(ret);
+    if (!reply.WriteParcelable(&cmdResponse)) {
+        ERR_LOG("reply write err parcel capacity:%{public}zu", reply.GetDataCapacity());
+    }
+    return ret;
 }
 } // namespace FileManagerService
 } // namespace OHOS
@@ -16,6 +16,7 @@
 #define STORAGE_SERVICES_MEDIA_FILE_OPER_H
 
 #include <string>
+#include <vector>
 #include "file_oper.h"
 namespace OHOS {
 namespace FileManagerService {
@@ -23,12 +24,23 @@ class MediaFileOper : public FileOper {
 public:
     MediaFileOper() = default;
     virtual ~MediaFileOper() = default;
-    int OperProcess(uint32_t code, MessageParcel &data, MessageParcel &reply) const override;
+    static const MediaFileOper &GetInstance();
+    int OperProcess(uint32_t code, uint32_t tokenId, MessageParcel &data, MessageParcel &reply) const override;
+    // handlers registered in the OperDispatcher table
+    static int HandleMkdir(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
+    static int HandleGetRoot(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
+    static int HandleListFile(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
+    static int HandleCreateFile(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
+    static int HandleGetFolderStats(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
+    static int HandleCreateFiles(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
 private:
     int CreateFile(const std::string &name, const std::string &path, MessageParcel &reply) const;
-    int ListFile(const std::string &type, const std::string &path, int offset, int count, MessageParcel &data) const;
+    int CreateFiles(const std::vector<std::string> &names, const std::string &path, MessageParcel &reply) const;
+    int ListFile(uint32_t tokenId, const std::string &type, const std::string &path, int offset, int count,
+        uint32_t flags, MessageParcel &reply) const;
     int GetRoot(const std::string &name, const std::string &path, MessageParcel &reply) const;
-    int Mkdir(const std::string &name, const std::string &path) const;
+    int Mkdir(const std::string &name, const std::string &path, MessageParcel &reply) const;
+    int GetFolderStats(const std::string &path, bool groupByType, MessageParcel &reply) const;
 };
 } // namespace FileManagerService
 } // namespace OHOS
@@ -16,41 +16,42 @@
 #include "media_file_utils.h"
 
 #include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
 
+#include "cmd_response.h"
+#include "compact_file_list.h"
 #include "data_ability_predicates.h"
 #include "file_manager_service_def.h"
 #include "file_manager_service_errno.h"
+#include "fms_metrics.h"
+#include "fms_trace.h"
 #include "log.h"
 #include "media_asset.h"
+#include "media_change_observer.h"
 #include "media_data_ability_const.h"
+#include "media_prefetcher.h"
+#include "media_projection.h"
 #include "rdb_errno.h"
 #include "values_bucket.h"
 
 using namespace std;
 namespace OHOS {
 namespace FileManagerService {
-bool GetPathFromResult(shared_ptr<NativeRdb::AbsSharedResultSet> result, string &path)
+// read the album relative path of the current row
+static bool GetPathFromRow(shared_ptr<NativeRdb::AbsSharedResultSet> result, const vector<int> &columnIndex,
+    string &path)
 {
-    int count = 0;
-    result->GetRowCount(count);
-    if (count == RESULTSET_EMPTY) {
-        ERR_LOG("AbsSharedResultSet null");
-        return false;
-    }
-    int32_t columnIndex = 0;
-    GET_COLUMN_INDEX_FROM_NAME(result, Media::MEDIA_DATA_DB_FILE_PATH, columnIndex);
-    result->GoToFirstRow();
-    int ret = result->GetString(columnIndex, path);
+    int ret = result->GetString(columnIndex[ALBUM_PATH_FILE_PATH], path);
     if (ret != NativeRdb::E_OK) {
         ERR_LOG("NativeRdb gets path index fail");
         return false;
     }
-    GET_COLUMN_INDEX_FROM_NAME(result, Media::MEDIA_DATA_DB_RELATIVE_PATH, columnIndex);
     string relativePath;
-    ret = result->GetString(columnIndex, relativePath);
+    ret = result->GetString(columnIndex[ALBUM_PATH_RELATIVE_PATH], relativePath);
     if (ret != NativeRdb::E_OK) {
         relativePath = "";
-        DEBUG_LOG("NativeRdb gets relative path is null %{public}d", columnIndex);
+        DEBUG_LOG("NativeRdb gets relative path is null %{public}d", columnIndex[ALBUM_PATH_RELATIVE_PATH]);
     }
     // get relative path from absolute path
     string::size_type pos = path.find_last_of('/');
@@ -60,6 +61,22 @@ bool GetPathFromResult(shared_ptr<NativeRdb::AbsSharedResultSet> result, string
     return true;
 }
 
+bool GetPathFromResult(shared_ptr<NativeRdb::AbsSharedResultSet> result, string &path)
+{
+    int count = 0;
+    result->GetRowCount(count);
+    if (count == RESULTSET_EMPTY) {
+        ERR_LOG("AbsSharedResultSet null");
+        return false;
+    }
+    vector<int> columnIndex;
+    if (!MediaProjection::AlbumPathProjection().Resolve(result, columnIndex)) {
+        return false;
+    }
+    result->GoToFirstRow();
+    return GetPathFromRow(result, columnIndex, path);
+}
+
 bool IsNumber(const string &str)
 {
     if (str.length() == 0) {
@@ -102,9 +119,8 @@ int GetMediaType(const string &name)
     return mediaType;
 }
 
-string GetMimeType(const string &name)
+string GetMimeType(int mediaType)
 {
-    int mediaType = GetMediaType(name);
     if (FILE_MIME_TYPE_MAPS.count(mediaType) == 0) {
         ERR_LOG("invalid mediaType %{public}d", mediaType);
         return FILE_MIME_TYPE;
@@ -112,21 +128,94 @@ string GetMimeType(const string &name)
     return FILE_MIME_TYPE_MAPS.at(mediaType);
 }
 
-bool GetPathFromAlbumPath(const string &albumUri, string &path)
+bool MediaFileUtils::GetPathFromAlbumPath(const string &albumUri, string &path)
 {
     string id;
     if (!GetPathID(albumUri, id)) {
         ERR_LOG("GetPathID fails");
         return false;
     }
+    bool hit = albumPathCache.Get(id, path);
+    FmsMetrics::GetInstance().RecordCache(CACHE_ALBUM_PATH, hit);
+    if (hit) {
+        return true;
+    }
+    uint64_t generation = albumPathCache.GetGeneration();
     string selection = Media::MEDIA_DATA_DB_ID + " LIKE ? ";
     vector<string> selectionArgs = {id};
-    shared_ptr<NativeRdb::AbsSharedResultSet> result = MediaFileUtils::DoQuery(selection, selectionArgs);
+    shared_ptr<NativeRdb::AbsSharedResultSet> result = MediaFileUtils::DoQuery(selection, selectionArgs,
+        MediaProjection::AlbumPathProjection());
     if (result == nullptr) {
         ERR_LOG("AbsSharedResultSet null");
         return false;
     }
-    return GetPathFromResult(result, path);
+    if (!GetPathFromResult(result, path)) {
+        return false;
+    }
+    albumPathCache.Put(id, path, generation);
+    return true;
+}
+
+vector<string> MediaFileUtils::GetCachedAlbumIds()
+{
+    return albumPathCache.GetIds();
+}
+
+int MediaFileUtils::WarmAlbumPathCache(const vector<string> &ids)
+{
+    vector<string> validIds;
+    for (const auto &id : ids) {
+        if (IsNumber(id) && validIds.size() < ALBUM_PATH_CACHE_CAPACITY) {
+            validIds.push_back(id);
+        }
+    }
+    if (validIds.empty()) {
+        return 0;
+    }
+    // the paths are read again instead of restored, albums may be renamed while the service was down
+    uint64_t generation = albumPathCache.GetGeneration();
+    string selection = Media::MEDIA_DATA_DB_ID + " IN (?";
+    for (size_t i = 1; i < validIds.size(); i++) {
+        selection += ",?";
+    }
+    selection += ")";
+    shared_ptr<NativeRdb::AbsSharedResultSet> result = MediaFileUtils::DoQuery(selection, validIds,
+        MediaProjection::AlbumPathProjection());
+    int count = 0;
+    if (result == nullptr || result->GetRowCount(count) != NativeRdb::E_OK || count <= 0) {
+        return 0;
+    }
+    vector<int> columnIndex;
+    if (!MediaProjection::AlbumPathProjection().Resolve(result, columnIndex)) {
+        return 0;
+    }
+    int warmed = 0;
+    result->GoToFirstRow();
+    for (int i = 0; i < count; i++) {
+        string id;
+        string path;
+        if (result->GetString(columnIndex[ALBUM_PATH_ID], id) == NativeRdb::E_OK &&
+            GetPathFromRow(result, columnIndex, path)) {
+            albumPathCache.Put(id, path, generation);
+            warmed++;
+        }
+        result->GoToNextRow();
+    }
+    return warmed;
+}
+
+void MediaFileUtils::OnMediaChange()
+{
+    albumPathCache.Clear();
+    MediaPrefetcher::GetInstance().Clear();
+}
+
+static string GetAssetUri(int mediaType, int64_t id)
+{
+    // use file id concatenate head as uri
+    string uri = (MEDIA_TYPE_URI_MAPS.count(mediaType) == 0) ? MEDIA_TYPE_URI_MAPS.at(FILE_MEDIA_TYPE) :
+        MEDIA_TYPE_URI_MAPS.at(mediaType);
+    return uri + "/" + to_string(id);
 }
 
 string GetType(string type)
@@ -154,12 +243,14 @@ bool GetAlbumFromResult(shared_ptr<NativeRdb::AbsSharedResultSet> &result, vecto
 {
     int count = 0;
     result->GetRowCount(count);
+    vector<int> columnIndex;
+    if (!MediaProjection::RelativePathProjection().Resolve(result, columnIndex)) {
+        return false;
+    }
     result->GoToFirstRow();
-    int32_t columnIndex;
-    GET_COLUMN_INDEX_FROM_NAME(result, Media::MEDIA_DATA_DB_RELATIVE_PATH, columnIndex);
     for (int i = 0; i < count; i++) {
         string path;
-        if (result->GetString(columnIndex, path) != NativeRdb::E_OK) {
+        if (result->GetString(columnIndex[RELATIVE_PATH_RELATIVE_PATH], path) != NativeRdb::E_OK) {
             ERR_LOG("NativeRdb gets path columnIndex fail");
             return false;
         }
@@ -181,7 +272,8 @@ vector<string> FindAlbumByType(string type)
     // then get the album
     string selection = Media::MEDIA_DATA_DB_MEDIA_TYPE + " LIKE ?";
     vector<string> selectionArgs = {type};
-    shared_ptr<NativeRdb::AbsSharedResultSet> result = MediaFileUtils::DoQuery(selection, selectionArgs);
+    shared_ptr<NativeRdb::AbsSharedResultSet> result = MediaFileUtils::DoQuery(selection, selectionArgs,
+        MediaProjection::RelativePathProjection());
     vector<string> album;
     if (result == nullptr) {
         ERR_LOG("query album type returns fail");
@@ -235,7 +327,7 @@ int CreateSelectionAndArgsOtherLevel(const string &type, const string &albumUri,
 {
     // get the album path from the album uri
     string albumPath;
-    if (!GetPathFromAlbumPath(albumUri, albumPath)) {
+    if (!MediaFileUtils::GetPathFromAlbumPath(albumUri, albumPath)) {
         ERR_LOG("path not exsit");
         return E_NOEXIST;
     }
@@ -253,21 +345,23 @@ int CreateSelectionAndArgsOtherLevel(const string &type, const string &albumUri,
     return SUCCESS;
 }
 
-bool GetAlbumPath(const string &name, const string &path, string &albumPath)
+bool GetAlbumPath(int mediaType, const string &path, string &albumPath)
 {
     if (IsFirstLevelUriPath(path)) {
-        int mediaType = GetMediaType(name);
         albumPath = (MEDIA_TYPE_FOLDER_MAPS.count(mediaType) == 0) ? MEDIA_TYPE_FOLDER_MAPS.at(FILE_MEDIA_TYPE) :
             MEDIA_TYPE_FOLDER_MAPS.at(mediaType);
         return true;
     }
-    return GetPathFromAlbumPath(path, albumPath);
+    return MediaFileUtils::GetPathFromAlbumPath(path, albumPath);
 }
 
 static void ShowSelecArgs(const string &selection, const vector<string> &selectionArgs)
 {
+    if (!FMS_LOG_ENABLED(LOG_DEBUG)) {
+        return;
+    }
     DEBUG_LOG("selection %{public}s ", selection.c_str());
-    for (auto s : selectionArgs) {
+    for (const auto &s : selectionArgs) {
         DEBUG_LOG("selectionArgs %{public}s", s.c_str());
     }
 }
@@ -275,6 +369,7 @@ static void ShowSelecArgs(const string &selection, const vector<string> &selecti
 int MediaFileUtils::DoListFile(const string &type, const string &path, int offset, int count,
     shared_ptr<NativeRdb::AbsSharedResultSet> &result)
 {
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
     string selection;
     vector<string> selectionArgs;
     if (IsFirstLevelUriPath(path)) {
@@ -287,7 +382,7 @@ int MediaFileUtils::DoListFile(const string &type, const string &path, int offse
             return err;
         }
     }
-    result = DoQuery(selection, selectionArgs, offset, count);
+    result = DoQuery(selection, selectionArgs, MediaProjection::FileInfoProjection(), offset, count);
     if (result == nullptr) {
         ERR_LOG("ListFile folder is empty");
         return E_EMPTYFOLDER;
@@ -296,14 +391,15 @@ int MediaFileUtils::DoListFile(const string &type, const string &path, int offse
 }
 
 shared_ptr<NativeRdb::AbsSharedResultSet> MediaFileUtils::DoQuery(const string &selection,
-    const vector<string> &selectionArgs)
+    const vector<string> &selectionArgs, const MediaProjection &projection)
 {
-    return DoQuery(selection, selectionArgs, 0, MAX_NUM);
+    return DoQuery(selection, selectionArgs, projection, 0, MAX_NUM);
 }
 
 shared_ptr<NativeRdb::AbsSharedResultSet> MediaFileUtils::DoQuery(const string &selection,
-    const vector<string> &selectionArgs, int offset, int count)
+    const vector<string> &selectionArgs, const MediaProjection &projection, int offset, int count)
 {
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
     ShowSelecArgs(selection, selectionArgs);
     NativeRdb::DataAbilityPredicates predicates;
     predicates.SetWhereClause(selection);
@@ -311,22 +407,23 @@ shared_ptr<NativeRdb::AbsSharedResultSet> MediaFileUtils::DoQuery(const string &
     predicates.SetOrder("date_taken DESC LIMIT " + ToString(offset) + "," + ToString(count));
     DEBUG_LOG("limit %{public}d, offset %{public}d", count, offset);
     Uri uri = Uri(Media::MEDIALIBRARY_DATA_URI);
-    vector<string> columns;
+    vector<string> columns = projection.GetColumns();
     return abilityHelper->Query(uri, columns, predicates);
 }
 
 int MediaFileUtils::DoInsert(const string &name, const string &path, const string &type, string &uri)
 {
     NativeRdb::ValuesBucket values;
+    int mediaType = GetMediaType(name);
     string albumPath;
-    if (!GetAlbumPath(name, path, albumPath)) {
+    if (!GetAlbumPath(mediaType, path, albumPath)) {
         ERR_LOG("path not exsit");
         return E_NOEXIST;
     }
     values.PutString(Media::MEDIA_DATA_DB_RELATIVE_PATH, albumPath);
     values.PutString(Media::MEDIA_DATA_DB_NAME, name);
-    values.PutString(Media::MEDIA_DATA_DB_MIME_TYPE, GetMimeType(name));
-    values.PutInt(Media::MEDIA_DATA_DB_MEDIA_TYPE, GetMediaType(name));
+    values.PutString(Media::MEDIA_DATA_DB_MIME_TYPE, GetMimeType(mediaType));
+    values.PutInt(Media::MEDIA_DATA_DB_MEDIA_TYPE, mediaType);
     Uri createAsset(Media::MEDIALIBRARY_DATA_URI + "/" + Media::MEDIA_FILEOPRN + "/" +
         Media::MEDIA_FILEOPRN_CREATEASSET);
     int index = abilityHelper->Insert(createAsset, values);
@@ -335,94 +432,389 @@ int MediaFileUtils::DoInsert(const string &name, const string &path, const strin
             path.c_str(), albumPath.c_str());
         return E_CREATE_FAIL;
     }
-    // use file id concatenate head as uri
-    uri = (MEDIA_TYPE_URI_MAPS.count(GetMediaType(name)) == 0) ? MEDIA_TYPE_URI_MAPS.at(FILE_MEDIA_TYPE) :
-        MEDIA_TYPE_URI_MAPS.at(GetMediaType(name));
-    uri += "/" + to_string(index);
+    uri = GetAssetUri(mediaType, index);
+    return SUCCESS;
+}
 
+static bool SplitAlbumName(const string &name, vector<string> &segments)
+{
+    string::size_type begin = 0;
+    while (begin <= name.size()) {
+        string::size_type end = name.find('/', begin);
+        if (end == string::npos) {
+            end = name.size();
+        }
+        string segment = name.substr(begin, end - begin);
+        if (segment.empty() || segment == "." || segment == "..") {
+            ERR_LOG("invalid album name %{private}s", name.c_str());
+            return false;
+        }
+        segments.emplace_back(segment);
+        begin = end + 1;
+    }
+    return !segments.empty();
+}
+
+static bool FindExistAlbum(const vector<string> &filePaths, unordered_set<string> &existPaths)
+{
+    string selection = Media::MEDIA_DATA_DB_MEDIA_TYPE + " = ? AND " + Media::MEDIA_DATA_DB_FILE_PATH + " IN (?";
+    vector<string> selectionArgs = { ToString(Media::MediaType::MEDIA_TYPE_ALBUM), filePaths[0] };
+    for (size_t i = 1; i < filePaths.size(); i++) {
+        selection += ",?";
+        selectionArgs.emplace_back(filePaths[i]);
+    }
+    selection += ")";
+    shared_ptr<NativeRdb::AbsSharedResultSet> result = MediaFileUtils::DoQuery(selection, selectionArgs,
+        MediaProjection::AlbumPathProjection());
+    if (result == nullptr) {
+        ERR_LOG("query album fail");
+        return false;
+    }
+    int count = 0;
+    result->GetRowCount(count);
+    vector<int> columnIndex;
+    if (count > 0 && !MediaProjection::AlbumPathProjection().Resolve(result, columnIndex)) {
+        return false;
+    }
+    result->GoToFirstRow();
+    for (int i = 0; i < count; i++) {
+        string filePath;
+        result->GetString(columnIndex[ALBUM_PATH_FILE_PATH], filePath);
+        existPaths.insert(filePath);
+        result->GoToNextRow();
+    }
+    return true;
+}
+
+/* mkdir
+ * ----name may be a nested path "a/b/c" under the album uri path
+ * ----find out which albums of the chain exist with one query
+ * ----insert the missing ones, parent first, with one BatchInsert
+ */
+int MediaFileUtils::DoMkdir(const string &name, const string &path)
+{
+    vector<string> segments;
+    if (!SplitAlbumName(name, segments) || segments.size() > MAX_NUM) {
+        return E_CREATE_FAIL;
+    }
+    string relativePath = RELATIVE_ROOT_PATH;
+    if (!IsFirstLevelUriPath(path) && !GetPathFromAlbumPath(path, relativePath)) {
+        ERR_LOG("path not exsit");
+        return E_NOEXIST;
+    }
+    // relative path and file path of each level
+    vector<string> parentPaths;
+    vector<string> filePaths;
+    for (auto &segment : segments) {
+        parentPaths.emplace_back(relativePath);
+        filePaths.emplace_back(MEDIA_ROOT_PATH + "/" + relativePath + segment);
+        relativePath += segment + "/";
+    }
+    unordered_set<string> existPaths;
+    if (!FindExistAlbum(filePaths, existPaths)) {
+        return FAIL;
+    }
+    vector<NativeRdb::ValuesBucket> values;
+    for (size_t i = 0; i < segments.size(); i++) {
+        if (existPaths.count(filePaths[i]) != 0) {
+            continue;
+        }
+        NativeRdb::ValuesBucket value;
+        value.PutString(Media::MEDIA_DATA_DB_FILE_PATH, filePaths[i]);
+        value.PutString(Media::MEDIA_DATA_DB_RELATIVE_PATH, parentPaths[i]);
+        value.PutString(Media::MEDIA_DATA_DB_NAME, segments[i]);
+        value.PutInt(Media::MEDIA_DATA_DB_MEDIA_TYPE, Media::MediaType::MEDIA_TYPE_ALBUM);
+        values.emplace_back(value);
+    }
+    if (values.empty()) {
+        DEBUG_LOG("album exists");
+        return SUCCESS;
+    }
+    Uri createAlbum(Media::MEDIALIBRARY_DATA_URI + "/" + Media::MEDIA_ALBUMOPRN + "/" +
+        Media::MEDIA_ALBUMOPRN_CREATEALBUM);
+    int inserted = abilityHelper->BatchInsert(createAlbum, values);
+    if (inserted < static_cast<int>(values.size())) {
+        ERR_LOG("Fail to create album %{private}s, %{public}d of %{public}zu created", name.c_str(), inserted,
+            values.size());
+        return E_CREATE_FAIL;
+    }
     return SUCCESS;
 }
 
-bool MediaFileUtils::InitMediaTableColIndexMap(shared_ptr<NativeRdb::AbsSharedResultSet> result)
+// find out the id of the names in album, in chunks to keep the number of selection args bounded
+static bool FindAssetId(const string &albumPath, const vector<string> &names, unordered_map<string, int64_t> &ids)
 {
-    if (mediaTableMap.size() == 0) {
-        DEBUG_LOG("init mediaTableMap");
-        vector<pair<string, string>> mediaData = {
-            {Media::MEDIA_DATA_DB_ID, "string"},
-            {Media::MEDIA_DATA_DB_URI, "string"},
-            {Media::MEDIA_DATA_DB_MEDIA_TYPE, "string"},
-            {Media::MEDIA_DATA_DB_NAME, "string"},
-            {Media::MEDIA_DATA_DB_SIZE, "int"},
-            {Media::MEDIA_DATA_DB_DATE_ADDED, "int"},
-            {Media::MEDIA_DATA_DB_DATE_MODIFIED, "int"}
-        };
-        for (auto i : mediaData) {
-            int columnIndex = 0;
-            GET_COLUMN_INDEX_FROM_NAME(result, i.first, columnIndex);
-            mediaTableMap.emplace_back(columnIndex, i.second);
+    for (size_t begin = 0; begin < names.size(); begin += MAX_NUM) {
+        size_t end = min(names.size(), begin + static_cast<size_t>(MAX_NUM));
+        string selection = Media::MEDIA_DATA_DB_RELATIVE_PATH + " = ? AND " + Media::MEDIA_DATA_DB_NAME + " IN (?";
+        vector<string> selectionArgs = { albumPath, names[begin] };
+        for (size_t i = begin + 1; i < end; i++) {
+            selection += ",?";
+            selectionArgs.emplace_back(names[i]);
+        }
+        selection += ")";
+        shared_ptr<NativeRdb::AbsSharedResultSet> result = MediaFileUtils::DoQuery(selection, selectionArgs,
+            MediaProjection::AssetIdProjection());
+        if (result == nullptr) {
+            ERR_LOG("query asset id fail");
+            return false;
+        }
+        int count = 0;
+        result->GetRowCount(count);
+        vector<int> columnIndex;
+        if (count > 0 && !MediaProjection::AssetIdProjection().Resolve(result, columnIndex)) {
+            return false;
+        }
+        result->GoToFirstRow();
+        for (int i = 0; i < count; i++) {
+            int64_t id = 0;
+            string name;
+            result->GetLong(columnIndex[ASSET_ID_ID], id);
+            result->GetString(columnIndex[ASSET_ID_NAME], name);
+            ids[name] = id;
+            result->GoToNextRow();
         }
     }
     return true;
 }
 
-bool MediaFileUtils::GetFileInfo(shared_ptr<NativeRdb::AbsSharedResultSet> result,
-    shared_ptr<FileInfo> &fileInfo)
+/* batch insert
+ * ----resolve the album path once, the media type of each name once
+ * ----find out the names already in the album, they fail as DoInsert does
+ * ----insert the others with one BatchInsert
+ * ----find out the id of the inserted names to build the uri
+ */
+int MediaFileUtils::DoBatchInsert(const vector<string> &names, const string &path, vector<string> &uris,
+    vector<int32_t> &errs)
 {
-    if (!InitMediaTableColIndexMap(result)) {
-        ERR_LOG("InitMediaTableColIndexMap returns fail");
-        return false;
+    uris.assign(names.size(), "");
+    errs.assign(names.size(), E_CREATE_FAIL);
+    string parentAlbumPath;
+    bool firstLevel = IsFirstLevelUriPath(path);
+    if (!firstLevel && !GetPathFromAlbumPath(path, parentAlbumPath)) {
+        ERR_LOG("path not exsit");
+        return E_NOEXIST;
     }
-    int index = 0;
+    vector<int> mediaTypes(names.size());
+    // album path -> names in that album
+    unordered_map<string, vector<string>> albumNames;
+    vector<string> albumPaths(names.size());
+    for (size_t i = 0; i < names.size(); i++) {
+        mediaTypes[i] = GetMediaType(names[i]);
+        if (!firstLevel) {
+            albumPaths[i] = parentAlbumPath;
+        } else {
+            GetAlbumPath(mediaTypes[i], path, albumPaths[i]);
+        }
+        albumNames[albumPaths[i]].emplace_back(names[i]);
+    }
+    unordered_map<string, unordered_map<string, int64_t>> existIds;
+    for (auto &album : albumNames) {
+        if (!FindAssetId(album.first, album.second, existIds[album.first])) {
+            return FAIL;
+        }
+    }
+    vector<NativeRdb::ValuesBucket> values;
+    unordered_map<string, unordered_map<string, size_t>> pending;
+    for (size_t i = 0; i < names.size(); i++) {
+        auto &albumPending = pending[albumPaths[i]];
+        if (existIds[albumPaths[i]].count(names[i]) != 0 || albumPending.count(names[i]) != 0) {
+            ERR_LOG("file %{public}s exists in album %{public}s", names[i].c_str(), albumPaths[i].c_str());
+            continue;
+        }
+        albumPending[names[i]] = i;
+        NativeRdb::ValuesBucket value;
+        value.PutString(Media::MEDIA_DATA_DB_RELATIVE_PATH, albumPaths[i]);
+        value.PutString(Media::MEDIA_DATA_DB_NAME, names[i]);
+        value.PutString(Media::MEDIA_DATA_DB_MIME_TYPE, GetMimeType(mediaTypes[i]));
+        value.PutInt(Media::MEDIA_DATA_DB_MEDIA_TYPE, mediaTypes[i]);
+        values.emplace_back(value);
+    }
+    if (values.empty()) {
+        return SUCCESS;
+    }
+    Uri createAsset(Media::MEDIALIBRARY_DATA_URI + "/" + Media::MEDIA_FILEOPRN + "/" +
+        Media::MEDIA_FILEOPRN_CREATEASSET);
+    int inserted = abilityHelper->BatchInsert(createAsset, values);
+    if (inserted <= 0) {
+        ERR_LOG("batch insert fail %{public}d of %{public}zu", inserted, values.size());
+        return E_CREATE_FAIL;
+    }
+    // on a partial insert only the names found below succeed, the others keep E_CREATE_FAIL
+    DEBUG_LOG("batch insert %{public}d of %{public}zu", inserted, values.size());
+    for (auto &album : pending) {
+        vector<string> albumPendingNames;
+        for (auto &item : album.second) {
+            albumPendingNames.emplace_back(item.first);
+        }
+        unordered_map<string, int64_t> ids;
+        if (albumPendingNames.empty() || !FindAssetId(album.first, albumPendingNames, ids)) {
+            continue;
+        }
+        for (auto &item : album.second) {
+            auto id = ids.find(item.first);
+            if (id != ids.end()) {
+                uris[item.second] = GetAssetUri(mediaTypes[item.second], id->second);
+                errs[item.second] = SUCCESS;
+            }
+        }
+    }
+    return SUCCESS;
+}
+
+static int WriteEmptyFileInfoList(Parcel &parcel, int err)
+{
+    parcel.WriteInt32(PARCELABLE_NOT_NULL);
+    CmdResponse::MarshallingHeader(parcel, err, "", 0);
+    return err;
+}
+
+int MediaFileUtils::WriteFileInfoFromResult(shared_ptr<NativeRdb::AbsSharedResultSet> result, Parcel &parcel,
+    bool compact)
+{
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
+    int count = 0;
+    result->GetRowCount(count);
+    if (count <= 0) {
+        ERR_LOG("AbsSharedResultSet null");
+        return WriteEmptyFileInfoList(parcel, E_EMPTYFOLDER);
+    }
+    vector<int> columnIndex;
+    if (!MediaProjection::FileInfoProjection().Resolve(result, columnIndex)) {
+        ERR_LOG("resolve file info columns fail");
+        return WriteEmptyFileInfoList(parcel, FAIL);
+    }
+    // same layout as WriteParcelable of a CmdResponse holding count FileInfo, without building them,
+    // the compact list follows a CmdResponse holding none
+    parcel.WriteInt32(PARCELABLE_NOT_NULL);
+    CmdResponse::MarshallingHeader(parcel, SUCCESS, "", compact ? 0 : count);
+    CompactFileListWriter writer;
     string id;
-    result->GetString(mediaTableMap[index++].first, id);
     string uri;
-    result->GetString(mediaTableMap[index++].first, uri);
-
-    string path = uri + "/" + id;
-    fileInfo->SetPath(path);
+    string path;
     string type;
-    result->GetString(mediaTableMap[index++].first, type);
-    fileInfo->SetType(type);
     string name;
-    result->GetString(mediaTableMap[index++].first, name);
-    fileInfo->SetName(name);
-    int64_t value;
-    result->GetLong(mediaTableMap[index++].first, value);
-    fileInfo->SetSize(value);
-    result->GetLong(mediaTableMap[index++].first, value);
-    fileInfo->SetAddedTime(value);
-    result->GetLong(mediaTableMap[index++].first, value);
-    fileInfo->SetModifiedTime(value);
-    return true;
+    int64_t size = 0;
+    int64_t addedTime = 0;
+    int64_t modifiedTime = 0;
+    result->GoToFirstRow();
+    for (int i = 0; i < count; i++) {
+        result->GetString(columnIndex[FILE_INFO_ID], id);
+        result->GetString(columnIndex[FILE_INFO_URI], uri);
+        path.assign(uri).append("/").append(id);
+        result->GetString(columnIndex[FILE_INFO_MEDIA_TYPE], type);
+        result->GetString(columnIndex[FILE_INFO_NAME], name);
+        result->GetLong(columnIndex[FILE_INFO_SIZE], size);
+        result->GetLong(columnIndex[FILE_INFO_DATE_ADDED], addedTime);
+        result->GetLong(columnIndex[FILE_INFO_DATE_MODIFIED], modifiedTime);
+        if (compact) {
+            writer.Add(path, name, type, size, addedTime, modifiedTime);
+        } else {
+            parcel.WriteInt32(PARCELABLE_NOT_NULL);
+            FileInfo::WriteToParcel(parcel, path, name, type, size, addedTime, modifiedTime);
+        }
+        result->GoToNextRow();
+    }
+    if (compact && !writer.WriteToParcel(parcel)) {
+        ERR_LOG("write compact file list fail");
+        return FAIL;
+    }
+    return SUCCESS;
 }
 
-int MediaFileUtils::GetFileInfoFromResult(shared_ptr<NativeRdb::AbsSharedResultSet> result,
-    std::vector<shared_ptr<FileInfo>> &fileList)
+static int GetFolderStatsFromResult(shared_ptr<NativeRdb::AbsSharedResultSet> result, bool groupByType,
+    vector<shared_ptr<FolderStats>> &statsList)
 {
     int count = 0;
     result->GetRowCount(count);
-    if (count == 0) {
-        ERR_LOG("AbsSharedResultSet null");
-        return E_EMPTYFOLDER;
+    vector<int> columnIndex;
+    if (count > 0 && !MediaProjection::StatsProjection().Resolve(result, columnIndex)) {
+        ERR_LOG("resolve stats columns fail");
+        return FAIL;
     }
     result->GoToFirstRow();
     for (int i = 0; i < count; i++) {
-        shared_ptr<FileInfo> fileInfo = make_shared<FileInfo>();
-        GetFileInfo(result, fileInfo);
-        fileList.push_back(fileInfo);
+        int mediaType = ALL_MEDIA_TYPE;
+        if (groupByType) {
+            result->GetInt(columnIndex[STATS_MEDIA_TYPE], mediaType);
+        }
+        int64_t fileCount = 0;
+        int64_t totalSize = 0;
+        int64_t lastModified = 0;
+        result->GetLong(columnIndex[STATS_COUNT], fileCount);
+        result->GetLong(columnIndex[STATS_TOTAL_SIZE], totalSize);
+        result->GetLong(columnIndex[STATS_LAST_MODIFIED], lastModified);
+        statsList.emplace_back(make_shared<FolderStats>(mediaType, fileCount, totalSize, lastModified));
         result->GoToNextRow();
     }
+    if (statsList.empty() && !groupByType) {
+        statsList.emplace_back(make_shared<FolderStats>());
+    }
     return SUCCESS;
 }
 
+/* folder stats
+ * --------first level view----
+ * --------selection MEDIA_DATA_DB_MEDIA_TYPE != album, the whole library
+ * --------other level view ----
+ * --------selection MEDIA_DATA_DB_RELATIVE_PATH == uri.MEDIA_DATA_DB_FILE_PATH, the direct children
+ * --------and MEDIA_DATA_DB_MEDIA_TYPE != album when not grouped, albums are only counted as their own row
+ * ----one row of COUNT(*), SUM(size), MAX(date_modified) for each media type when grouped
+ */
+int MediaFileUtils::DoGetFolderStats(const string &path, bool groupByType,
+    vector<shared_ptr<FolderStats>> &statsList)
+{
+    string selection;
+    vector<string> selectionArgs;
+    if (IsFirstLevelUriPath(path)) {
+        selection = Media::MEDIA_DATA_DB_MEDIA_TYPE + " <> ?";
+        selectionArgs = { ToString(Media::MediaType::MEDIA_TYPE_ALBUM) };
+    } else {
+        string albumPath;
+        if (!GetPathFromAlbumPath(path, albumPath)) {
+            ERR_LOG("path not exsit");
+            return E_NOEXIST;
+        }
+        selection = Media::MEDIA_DATA_DB_RELATIVE_PATH + " LIKE ?";
+        selectionArgs = { albumPath };
+        // the same totals as ExternalStorageUtils::GetDirStats, child albums are no files
+        if (!groupByType) {
+            selection += " AND " + Media::MEDIA_DATA_DB_MEDIA_TYPE + " <> ?";
+            selectionArgs.push_back(ToString(Media::MediaType::MEDIA_TYPE_ALBUM));
+        }
+    }
+    ShowSelecArgs(selection, selectionArgs);
+    NativeRdb::DataAbilityPredicates predicates;
+    predicates.SetWhereClause(selection);
+    predicates.SetWhereArgs(selectionArgs);
+    if (groupByType) {
+        predicates.GroupBy({ Media::MEDIA_DATA_DB_MEDIA_TYPE });
+    }
+    Uri uri = Uri(Media::MEDIALIBRARY_DATA_URI);
+    vector<string> columns = MediaProjection::StatsProjection().GetColumns();
+    shared_ptr<NativeRdb::AbsSharedResultSet> result = abilityHelper->Query(uri, columns, predicates);
+    if (result == nullptr) {
+        ERR_LOG("query folder stats fail");
+        return FAIL;
+    }
+    return GetFolderStatsFromResult(result, groupByType, statsList);
+}
+
 bool MediaFileUtils::InitHelper(sptr<IRemoteObject> obj)
 {
+    // called from the binder threads and the cache warm up of the service start
+    lock_guard<mutex> lock(helperMutex);
     if (abilityHelper == nullptr) {
         abilityHelper =  AppExecFwk::DataAbilityHelper::Creator(obj, make_shared<Uri>(Media::MEDIALIBRARY_DATA_URI));
         if (abilityHelper == nullptr) {
             DEBUG_LOG("get %{private}s helper fail", Media::MEDIALIBRARY_DATA_URI.c_str());
             return false;
         }
+        // album id to path mapping is kept valid by the media library change notification
+        mediaObserver = new (nothrow) MediaChangeObserver();
+        if (mediaObserver != nullptr) {
+            abilityHelper->RegisterObserver(Uri(Media::MEDIALIBRARY_DATA_URI), mediaObserver);
+        }
     }
     return true;
 }
@@ -430,14 +822,11 @@ bool MediaFileUtils::InitHelper(sptr<IRemoteObject> obj)
 int MediaFileUtils::DoGetRoot(const std::string &name, const std::string &path,
     std::vector<shared_ptr<FileInfo>> &fileList)
 {
-    shared_ptr<FileInfo> image = make_shared<FileInfo>(IMAGE_ROOT_NAME, FISRT_LEVEL_ALBUM, ALBUM_TYPE);
-    fileList.emplace_back(image);
-    shared_ptr<FileInfo> video = make_shared<FileInfo>(VIDEO_ROOT_NAME, FISRT_LEVEL_ALBUM, ALBUM_TYPE);
-    fileList.emplace_back(video);
-    shared_ptr<FileInfo> audio = make_shared<FileInfo>(AUDIO_ROOT_NAME, FISRT_LEVEL_ALBUM, ALBUM_TYPE);
-    fileList.emplace_back(audio);
-    shared_ptr<FileInfo> file = make_shared<FileInfo>(FILE_ROOT_NAME, FISRT_LEVEL_ALBUM, ALBUM_TYPE);
-    fileList.emplace_back(file);
+    // the root albums are static, their counts and sizes are left to GET_FOLDER_STATS on demand
+    fileList.emplace_back(make_shared<FileInfo>(IMAGE_ROOT_NAME, FISRT_LEVEL_ALBUM, ALBUM_TYPE));
+    fileList.emplace_back(make_shared<FileInfo>(VIDEO_ROOT_NAME, FISRT_LEVEL_ALBUM, ALBUM_TYPE));
+    fileList.emplace_back(make_shared<FileInfo>(AUDIO_ROOT_NAME, FISRT_LEVEL_ALBUM, ALBUM_TYPE));
+    fileList.emplace_back(make_shared<FileInfo>(FILE_ROOT_NAME, FISRT_LEVEL_ALBUM, ALBUM_TYPE));
     return SUCCESS;
 }
 } // namespace FileManagerService
@@ -15,12 +15,16 @@
 #ifndef STORAGE_SERIVCES_MEDIA_FILE_UTILS_H
 #define STORAGE_SERIVCES_MEDIA_FILE_UTILS_H
 
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include "abs_shared_result_set.h"
+#include "album_path_cache.h"
 #include "file_info.h"
 #include "file_oper.h"
+#include "folder_stats.h"
+#include "media_projection.h"
 
 #include "ipc_types.h"
 #include "iremote_broker.h"
@@ -40,18 +44,28 @@ public:
     static int DoListFile(const std::string &type, const std::string &path, int offset, int count,
         std::shared_ptr<NativeRdb::AbsSharedResultSet> &result);
     static std::shared_ptr<NativeRdb::AbsSharedResultSet> DoQuery(const std::string &selection,
-        const std::vector<std::string> &selectionArgs);
+        const std::vector<std::string> &selectionArgs, const MediaProjection &projection);
     static std::shared_ptr<NativeRdb::AbsSharedResultSet> DoQuery(const std::string &selection,
-        const std::vector<std::string> &selectionArgs, int offset, int count);
+        const std::vector<std::string> &selectionArgs, const MediaProjection &projection, int offset, int count);
+    static int DoGetFolderStats(const std::string &path, bool groupByType,
+        std::vector<std::shared_ptr<FolderStats>> &statsList);
     static int DoInsert(const std::string &name, const std::string &path, const std::string &type, std::string &uri);
-    static bool GetFileInfo(std::shared_ptr<NativeRdb::AbsSharedResultSet> result, std::shared_ptr<FileInfo> &fileInfo);
-    static int GetFileInfoFromResult(std::shared_ptr<NativeRdb::AbsSharedResultSet> result,
-        std::vector<std::shared_ptr<FileInfo>> &fileList);
-    static bool InitMediaTableColIndexMap(std::shared_ptr<NativeRdb::AbsSharedResultSet> result);
+    static int DoMkdir(const std::string &name, const std::string &path);
+    static int DoBatchInsert(const std::vector<std::string> &names, const std::string &path,
+        std::vector<std::string> &uris, std::vector<int32_t> &errs);
+    static int WriteFileInfoFromResult(std::shared_ptr<NativeRdb::AbsSharedResultSet> result, Parcel &parcel,
+        bool compact);
     static bool InitHelper(sptr<IRemoteObject> obj);
+    static bool GetPathFromAlbumPath(const std::string &albumUri, std::string &path);
+    static void OnMediaChange();
+    static std::vector<std::string> GetCachedAlbumIds();
+    // query the paths of album ids in one go, return the number of cached entries
+    static int WarmAlbumPathCache(const std::vector<std::string> &ids);
 private:
-    inline static std::vector<std::pair<int, std::string>> mediaTableMap = {};
+    inline static std::mutex helperMutex;
     inline static std::shared_ptr<AppExecFwk::DataAbilityHelper> abilityHelper = nullptr;
+    inline static sptr<AAFwk::IDataAbilityObserver> mediaObserver = nullptr;
+    inline static AlbumPathCache albumPathCache;
 };
 } // namespace FileManagerService
 } // namespace OHOS
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media_prefetcher.h"
+
+#include "file_manager_service_errno.h"
+#include "log.h"
+#include "media_file_utils.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+namespace {
+constexpr int PREFETCH_THREAD_NUM = 1;
+}
+
+MediaPrefetcher &MediaPrefetcher::GetInstance()
+{
+    static MediaPrefetcher instance;
+    return instance;
+}
+
+MediaPrefetcher::~MediaPrefetcher()
+{
+    if (started_) {
+        pool_.Stop();
+    }
+}
+
+string MediaPrefetcher::GetKey(uint32_t tokenId, const string &type, const string &path, int offset, int count)
+{
+    return to_string(tokenId) + "|" + type + "|" + path + "|" + to_string(offset) + "|" + to_string(count);
+}
+
+shared_ptr<NativeRdb::AbsSharedResultSet> MediaPrefetcher::Take(uint32_t tokenId, const string &type,
+    const string &path, int offset, int count)
+{
+    string key = GetKey(tokenId, type, path, offset, count);
+    unique_lock<mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        return nullptr;
+    }
+    // the query would be issued anyway, waiting for the running one is never slower
+    auto expireTime = it->second.expireTime;
+    cv_.wait_until(lock, expireTime, [this, &key] {
+        auto entry = entries_.find(key);
+        return entry == entries_.end() || !entry->second.pending;
+    });
+    it = entries_.find(key);
+    if (it == entries_.end()) {
+        return nullptr;
+    }
+    shared_ptr<NativeRdb::AbsSharedResultSet> result = it->second.result;
+    bool expired = chrono::steady_clock::now() > it->second.expireTime;
+    entries_.erase(it);
+    if (expired) {
+        DEBUG_LOG("prefetched page expired");
+        return nullptr;
+    }
+    return result;
+}
+
+void MediaPrefetcher::Prefetch(uint32_t tokenId, const string &type, const string &path, int offset, int count)
+{
+    string key = GetKey(tokenId, type, path, offset, count);
+    uint64_t generation = 0;
+    {
+        lock_guard<mutex> lock(mutex_);
+        auto now = chrono::steady_clock::now();
+        RemoveExpired(now);
+        if (entries_.count(key) != 0 || entries_.size() >= PREFETCH_MAX_ENTRIES) {
+            return;
+        }
+        if (!started_) {
+            pool_.Start(PREFETCH_THREAD_NUM);
+            started_ = true;
+        }
+        generation = generation_;
+        Entry entry;
+        entry.generation = generation;
+        entry.expireTime = now + chrono::milliseconds(PREFETCH_TTL_MS);
+        entries_.emplace(key, entry);
+    }
+    pool_.AddTask([this, key, generation, type, path, offset, count]() {
+        shared_ptr<NativeRdb::AbsSharedResultSet> result;
+        if (MediaFileUtils::DoListFile(type, path, offset, count, result) != SUCCESS) {
+            result = nullptr;
+        }
+        Complete(key, generation, result);
+    });
+}
+
+void MediaPrefetcher::Complete(const string &key, uint64_t generation, shared_ptr<NativeRdb::AbsSharedResultSet> result)
+{
+    {
+        lock_guard<mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it == entries_.end() || it->second.generation != generation) {
+            return;
+        }
+        if (result == nullptr) {
+            entries_.erase(it);
+        } else {
+            it->second.pending = false;
+            it->second.result = result;
+        }
+    }
+    cv_.notify_all();
+}
+
+void MediaPrefetcher::RemoveExpired(chrono::steady_clock::time_point now)
+{
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (!it->second.pending && now > it->second.expireTime) {
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void MediaPrefetcher::Clear()
+{
+    {
+        lock_guard<mutex> lock(mutex_);
+        generation_++;
+        entries_.clear();
+    }
+    cv_.notify_all();
+}
+
+size_t MediaPrefetcher::Size()
+{
+    lock_guard<mutex> lock(mutex_);
+    return entries_.size();
+}
+} // namespace FileManagerService
+} // namespace OHOS
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef STORAGE_SERVICES_MEDIA_PREFETCHER_H
+#define STORAGE_SERVICES_MEDIA_PREFETCHER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "abs_shared_result_set.h"
+#include "thread_pool.h"
+
+namespace OHOS {
+namespace FileManagerService {
+constexpr int64_t PREFETCH_TTL_MS = 3000;
+constexpr size_t PREFETCH_MAX_ENTRIES = 16;
+/**
+ * @class MediaPrefetcher
+ * Run the query of the next media listing page of a caller in the background and keep it
+ * for a short time, the follow-up ListFile takes the result instead of querying again.
+ */
+class MediaPrefetcher {
+public:
+    static MediaPrefetcher &GetInstance();
+    /**
+     * @brief Take the prefetched page, wait for it when its query is still running.
+     * @return nullptr if the page is not prefetched or expired.
+     */
+    std::shared_ptr<NativeRdb::AbsSharedResultSet> Take(uint32_t tokenId, const std::string &type,
+        const std::string &path, int offset, int count);
+    void Prefetch(uint32_t tokenId, const std::string &type, const std::string &path, int offset, int count);
+    void Clear();
+    size_t Size();
+private:
+    struct Entry {
+        bool pending {true};
+        // generation of the prefetch that made the entry, a query from before Clear leaves a newer entry alone
+        uint64_t generation {0};
+        std::chrono::steady_clock::time_point expireTime;
+        std::shared_ptr<NativeRdb::AbsSharedResultSet> result;
+    };
+    MediaPrefetcher() = default;
+    ~MediaPrefetcher();
+    static std::string GetKey(uint32_t tokenId, const std::string &type, const std::string &path,
+        int offset, int count);
+    void Complete(const std::string &key, uint64_t generation, std::shared_ptr<NativeRdb::AbsSharedResultSet> result);
+    void RemoveExpired(std::chrono::steady_clock::time_point now);
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    uint64_t generation_ {0};
+    bool started_ {false};
+    ThreadPool pool_ {"FmsPrefetch"};
+    std::unordered_map<std::string, Entry> entries_;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_MEDIA_PREFETCHER_H
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media_projection.h"
+
+#include "log.h"
+#include "media_data_ability_const.h"
+#include "rdb_errno.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+bool MediaProjection::Resolve(const shared_ptr<NativeRdb::AbsSharedResultSet> &result, vector<int> &columnIndex) const
+{
+    columnIndex.assign(columns_.size(), 0);
+    for (size_t i = 0; i < columns_.size(); i++) {
+        if (result->GetColumnIndex(columns_[i], columnIndex[i]) != NativeRdb::E_OK) {
+            ERR_LOG("NativeRdb gets %{public}s index fail", columns_[i].c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+const MediaProjection &MediaProjection::FileInfoProjection()
+{
+    // keep the order of FileInfoColumn
+    static const MediaProjection projection({
+        Media::MEDIA_DATA_DB_ID,
+        Media::MEDIA_DATA_DB_URI,
+        Media::MEDIA_DATA_DB_MEDIA_TYPE,
+        Media::MEDIA_DATA_DB_NAME,
+        Media::MEDIA_DATA_DB_SIZE,
+        Media::MEDIA_DATA_DB_DATE_ADDED,
+        Media::MEDIA_DATA_DB_DATE_MODIFIED
+    });
+    return projection;
+}
+
+const MediaProjection &MediaProjection::AlbumPathProjection()
+{
+    // keep the order of AlbumPathColumn
+    static const MediaProjection projection({
+        Media::MEDIA_DATA_DB_FILE_PATH,
+        Media::MEDIA_DATA_DB_RELATIVE_PATH,
+        Media::MEDIA_DATA_DB_ID
+    });
+    return projection;
+}
+
+const MediaProjection &MediaProjection::RelativePathProjection()
+{
+    static const MediaProjection projection({
+        Media::MEDIA_DATA_DB_RELATIVE_PATH
+    });
+    return projection;
+}
+
+const MediaProjection &MediaProjection::AssetIdProjection()
+{
+    // keep the order of AssetIdColumn
+    static const MediaProjection projection({
+        Media::MEDIA_DATA_DB_ID,
+        Media::MEDIA_DATA_DB_NAME
+    });
+    return projection;
+}
+
+const MediaProjection &MediaProjection::StatsProjection()
+{
+    // keep the order of StatsColumn
+    static const MediaProjection projection({
+        Media::MEDIA_DATA_DB_MEDIA_TYPE,
+        "COUNT(*)",
+        "SUM(" + Media::MEDIA_DATA_DB_SIZE + ")",
+        "MAX(" + Media::MEDIA_DATA_DB_DATE_MODIFIED + ")"
+    });
+    return projection;
+}
+} // namespace FileManagerService
+} // namespace OHOS
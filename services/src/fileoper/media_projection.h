@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef STORAGE_SERVICES_MEDIA_PROJECTION_H
+#define STORAGE_SERVICES_MEDIA_PROJECTION_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abs_shared_result_set.h"
+
+namespace OHOS {
+namespace FileManagerService {
+enum FileInfoColumn {
+    FILE_INFO_ID = 0,
+    FILE_INFO_URI,
+    FILE_INFO_MEDIA_TYPE,
+    FILE_INFO_NAME,
+    FILE_INFO_SIZE,
+    FILE_INFO_DATE_ADDED,
+    FILE_INFO_DATE_MODIFIED
+};
+
+enum AlbumPathColumn {
+    ALBUM_PATH_FILE_PATH = 0,
+    ALBUM_PATH_RELATIVE_PATH,
+    ALBUM_PATH_ID
+};
+
+enum RelativePathColumn {
+    RELATIVE_PATH_RELATIVE_PATH = 0
+};
+
+enum AssetIdColumn {
+    ASSET_ID_ID = 0,
+    ASSET_ID_NAME
+};
+
+enum StatsColumn {
+    STATS_MEDIA_TYPE = 0,
+    STATS_COUNT,
+    STATS_TOTAL_SIZE,
+    STATS_LAST_MODIFIED
+};
+
+/**
+ * @class MediaProjection
+ * Columns queried by one query shape, the column index is resolved once for each result set
+ * and indexed by the column enum of the shape.
+ */
+class MediaProjection {
+public:
+    explicit MediaProjection(const std::vector<std::string> &columns) : columns_(columns) {}
+    ~MediaProjection() = default;
+    const std::vector<std::string> &GetColumns() const
+    {
+        return columns_;
+    }
+    bool Resolve(const std::shared_ptr<NativeRdb::AbsSharedResultSet> &result, std::vector<int> &columnIndex) const;
+
+    static const MediaProjection &FileInfoProjection();
+    static const MediaProjection &AlbumPathProjection();
+    static const MediaProjection &RelativePathProjection();
+    static const MediaProjection &AssetIdProjection();
+    static const MediaProjection &StatsProjection();
+private:
+    std::vector<std::string> columns_;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_MEDIA_PROJECTION_H
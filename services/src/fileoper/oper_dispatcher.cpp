@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "oper_dispatcher.h"
+
+#include <array>
+
+#include "cmd_response.h"
+#include "external_storage_oper.h"
+#include "file_manager_service_def.h"
+#include "file_manager_service_errno.h"
+#include "local_directory_oper.h"
+#include "local_directory_utils.h"
+#include "log.h"
+#include "media_file_oper.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+namespace {
+struct ProviderEntry {
+    Equipment equipment;
+    // device name in CmdOptions which the client resolves to the equipment
+    const char *name;
+    const FileOper &(*getInstance)();
+    // a disabled provider is left out of GET_PROVIDERS and has no handlers
+    bool (*isEnabled)();
+};
+
+struct OperEntry {
+    Equipment equipment;
+    Operation operation;
+    OperHandler handler;
+};
+
+template<typename Oper>
+const FileOper &GetProviderInstance()
+{
+    return Oper::GetInstance();
+}
+
+bool IsAlwaysEnabled()
+{
+    return true;
+}
+
+// register a new provider here and its handlers in OPER_ENTRIES
+constexpr ProviderEntry PROVIDER_ENTRIES[] = {
+    { Equipment::INTERNAL_STORAGE, INTERNAL_STORAGE_NAME, GetProviderInstance<MediaFileOper>, IsAlwaysEnabled },
+    { Equipment::EXTERNAL_STORAGE, EXTERNAL_STORAGE_NAME, GetProviderInstance<ExternalStorageOper>,
+        IsAlwaysEnabled },
+    { Equipment::LOCAL_DIRECTORY, LOCAL_DIRECTORY_NAME, GetProviderInstance<LocalDirectoryOper>,
+        LocalDirectoryUtils::IsEnabled },
+};
+
+const ProviderEntry *GetProviderEntry(int equipmentId)
+{
+    for (const auto &entry : PROVIDER_ENTRIES) {
+        if (entry.equipment == equipmentId) {
+            return entry.isEnabled() ? &entry : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+constexpr OperEntry OPER_ENTRIES[] = {
+    { Equipment::INTERNAL_STORAGE, Operation::GET_ROOT, MediaFileOper::HandleGetRoot },
+    { Equipment::INTERNAL_STORAGE, Operation::MAKE_DIR, MediaFileOper::HandleMkdir },
+    { Equipment::INTERNAL_STORAGE, Operation::LIST_FILE, MediaFileOper::HandleListFile },
+    { Equipment::INTERNAL_STORAGE, Operation::CREATE_FILE, MediaFileOper::HandleCreateFile },
+    { Equipment::INTERNAL_STORAGE, Operation::GET_FOLDER_STATS, MediaFileOper::HandleGetFolderStats },
+    { Equipment::INTERNAL_STORAGE, Operation::CREATE_FILES, MediaFileOper::HandleCreateFiles },
+    { Equipment::EXTERNAL_STORAGE, Operation::GET_ROOT, ExternalStorageOper::HandleGetRoot },
+    { Equipment::EXTERNAL_STORAGE, Operation::LIST_FILE, ExternalStorageOper::HandleListFile },
+    { Equipment::EXTERNAL_STORAGE, Operation::CREATE_FILE, ExternalStorageOper::HandleCreateFile },
+    { Equipment::EXTERNAL_STORAGE, Operation::GET_FOLDER_STATS, ExternalStorageOper::HandleGetFolderStats },
+    { Equipment::EXTERNAL_STORAGE, Operation::CREATE_FILES, ExternalStorageOper::HandleCreateFiles },
+    { Equipment::LOCAL_DIRECTORY, Operation::GET_ROOT, LocalDirectoryOper::HandleGetRoot },
+    { Equipment::LOCAL_DIRECTORY, Operation::MAKE_DIR, LocalDirectoryOper::HandleMkdir },
+    { Equipment::LOCAL_DIRECTORY, Operation::LIST_FILE, LocalDirectoryOper::HandleListFile },
+    { Equipment::LOCAL_DIRECTORY, Operation::CREATE_FILE, LocalDirectoryOper::HandleCreateFile },
+    { Equipment::LOCAL_DIRECTORY, Operation::CREATE_FILES, LocalDirectoryOper::HandleCreateFiles },
+};
+
+using OperTable = array<array<OperHandler, Operation::OPERATION_BUTT>, Equipment::EQUIPMENT_BUTT>;
+
+constexpr OperTable BuildOperTable()
+{
+    OperTable table {};
+    for (const auto &entry : OPER_ENTRIES) {
+        table[entry.equipment][entry.operation] = entry.handler;
+    }
+    return table;
+}
+
+constexpr OperTable OPER_TABLE = BuildOperTable();
+} // namespace
+
+OperHandler OperDispatcher::GetHandler(int equipmentId, int operCode)
+{
+    if (equipmentId < 0 || equipmentId >= Equipment::EQUIPMENT_BUTT || operCode < 0 ||
+        operCode >= Operation::OPERATION_BUTT) {
+        return nullptr;
+    }
+    OperHandler handler = OPER_TABLE[equipmentId][operCode];
+    if (handler == nullptr || GetProviderEntry(equipmentId) == nullptr) {
+        return nullptr;
+    }
+    return handler;
+}
+
+int OperDispatcher::Dispatch(int equipmentId, int operCode, uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    if (equipmentId < 0 || equipmentId >= Equipment::EQUIPMENT_BUTT) {
+        ERR_LOG("invalid equipment %{public}d", equipmentId);
+        return FAIL;
+    }
+    OperHandler handler = GetHandler(equipmentId, operCode);
+    if (handler == nullptr) {
+        ERR_LOG("not valid code %{public}d of equipment %{public}d", operCode, equipmentId);
+        return E_INVALID_OPERCODE;
+    }
+    return handler(tokenId, data, reply);
+}
+
+const FileOper *OperDispatcher::GetFileOper(int equipmentId)
+{
+    const ProviderEntry *entry = GetProviderEntry(equipmentId);
+    return entry == nullptr ? nullptr : &entry->getInstance();
+}
+
+uint32_t OperDispatcher::GetCapabilities(int equipmentId)
+{
+    uint32_t capabilities = 0;
+    for (int operCode = 0; operCode < Operation::OPERATION_BUTT; operCode++) {
+        if (GetHandler(equipmentId, operCode) != nullptr) {
+            capabilities |= GetCapability(operCode);
+        }
+    }
+    return capabilities;
+}
+
+vector<shared_ptr<ProviderInfo>> OperDispatcher::GetProviders()
+{
+    vector<shared_ptr<ProviderInfo>> providerList;
+    for (const auto &entry : PROVIDER_ENTRIES) {
+        if (!entry.isEnabled()) {
+            continue;
+        }
+        providerList.push_back(make_shared<ProviderInfo>(entry.equipment, entry.name,
+            GetCapabilities(entry.equipment)));
+    }
+    return providerList;
+}
+
+int OperDispatcher::HandleGetProviders(MessageParcel &data, MessageParcel &reply)
+{
+    CmdResponse cmdResponse;
+    cmdResponse.SetErr(SUCCESS);
+    if (!reply.WriteParcelable(&cmdResponse) || !ProviderInfo::MarshallingList(reply, GetProviders())) {
+        ERR_LOG("reply write err parcel capacity:%{public}zu", reply.GetDataCapacity());
+        return FAIL;
+    }
+    return SUCCESS;
+}
+} // namespace FileManagerService
+} // namespace OHOS
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef STORAGE_SERVICES_OPER_DISPATCHER_H
+#define STORAGE_SERVICES_OPER_DISPATCHER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "file_oper.h"
+#include "provider_info.h"
+
+namespace OHOS {
+namespace FileManagerService {
+/**
+ * @class OperDispatcher
+ * Registry of the storage providers. Map (equipment, operation) to the handler of the provider, the table
+ * is built at compile time from the entries registered in oper_dispatcher.cpp, and the capabilities
+ * of a provider are the operations it registered.
+ */
+class OperDispatcher {
+public:
+    static OperHandler GetHandler(int equipmentId, int operCode);
+    static int Dispatch(int equipmentId, int operCode, uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
+    static const FileOper *GetFileOper(int equipmentId);
+    static uint32_t GetCapabilities(int equipmentId);
+    static std::vector<std::shared_ptr<ProviderInfo>> GetProviders();
+    // reply the id, device name and capabilities of every provider for GET_PROVIDERS
+    static int HandleGetProviders(MessageParcel &data, MessageParcel &reply);
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_OPER_DISPATCHER_H
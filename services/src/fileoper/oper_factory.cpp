@@ -15,34 +15,17 @@
 
 #include "oper_factory.h"
 
-#include "external_storage_oper.h"
-#include "file_manager_service_def.h"
 #include "file_oper.h"
 #include "log.h"
-#include "media_file_oper.h"
+#include "oper_dispatcher.h"
 
 using namespace std;
 namespace OHOS {
 namespace FileManagerService {
-unique_ptr<FileOper> OperFactory::GetFileOper(int equipmentId)
+const FileOper *OperFactory::GetFileOper(int equipmentId)
 {
-    unique_ptr<FileOper> fp;
     DEBUG_LOG("FileOper %{public}d.", equipmentId);
-    switch (equipmentId) {
-        case Equipment::INTERNAL_STORAGE: {
-            fp = make_unique<MediaFileOper>();
-            break;
-        }
-        case Equipment::EXTERNAL_STORAGE: {
-            fp = make_unique<ExternalStorageOper>();
-            break;
-        }
-        default: {
-            DEBUG_LOG("default FileOper %{public}d.", equipmentId);
-            break;
-        }
-    }
-    return fp;
+    return OperDispatcher::GetFileOper(equipmentId);
 }
 } // namespace FileManagerService
 } // namespace OHOS
\ No newline at end of file
@@ -24,7 +24,8 @@ namespace OHOS {
 namespace FileManagerService {
 class OperFactory {
 public:
-    std::unique_ptr<FileOper> GetFileOper(int equipmentId);
+    // the provider is long-lived and not owned by the caller
+    const FileOper *GetFileOper(int equipmentId);
 };
 } // namespace FileManagerService
 } // namespace OHOS
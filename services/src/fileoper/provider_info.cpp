@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "provider_info.h"
+#include "log.h"
+using namespace std;
+
+namespace OHOS {
+namespace FileManagerService {
+bool ProviderInfo::Marshalling(Parcel &parcel) const
+{
+    parcel.WriteInt32(id_);
+    parcel.WriteString(name_);
+    parcel.WriteUint32(capabilities_);
+    return true;
+}
+
+bool ProviderInfo::MarshallingList(Parcel &parcel, const vector<shared_ptr<ProviderInfo>> &providerList)
+{
+    parcel.WriteUint64(providerList.size());
+    for (auto &provider : providerList) {
+        if (!parcel.WriteParcelable(provider.get())) {
+            ERR_LOG("Marshalling ProviderInfo fails!");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ProviderInfo::UnmarshallingList(Parcel &parcel, vector<shared_ptr<ProviderInfo>> &providerList)
+{
+    size_t providerCount = parcel.ReadUint64();
+    for (size_t i = 0; i < providerCount; i++) {
+        shared_ptr<ProviderInfo> provider(parcel.ReadParcelable<ProviderInfo>());
+        if (provider == nullptr) {
+            ERR_LOG("Unmarshalling ProviderInfo fails!");
+            return false;
+        }
+        providerList.emplace_back(provider);
+    }
+    return true;
+}
+
+ProviderInfo* ProviderInfo::Unmarshalling(Parcel &parcel)
+{
+    auto *obj = new (std::nothrow) ProviderInfo();
+    if (obj == nullptr) {
+        ERR_LOG("Unmarshalling fail");
+        return nullptr;
+    }
+    obj->id_ = parcel.ReadInt32();
+    obj->name_ = parcel.ReadString();
+    obj->capabilities_ = parcel.ReadUint32();
+    return obj;
+}
+} // namespace FileManagerService
+} // namespace OHOS
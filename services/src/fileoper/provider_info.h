@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_PROVIDER_INFO_H
+#define STORAGE_SERVICES_PROVIDER_INFO_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "parcel.h"
+
+namespace OHOS {
+namespace FileManagerService {
+// capability bit of an operation, set when the provider registered a handler for it
+constexpr uint32_t GetCapability(int operation)
+{
+    return 1u << operation;
+}
+
+class ProviderInfo : public Parcelable {
+public:
+    ProviderInfo(int32_t id, const std::string &name, uint32_t capabilities)
+        : id_(id), name_(name), capabilities_(capabilities) {}
+    ProviderInfo() = default;
+    ~ProviderInfo() = default;
+
+    int32_t GetId() const
+    {
+        return id_;
+    }
+    std::string GetName() const
+    {
+        return name_;
+    }
+    uint32_t GetCapabilities() const
+    {
+        return capabilities_;
+    }
+    bool IsSupported(int operation) const
+    {
+        return (capabilities_ & GetCapability(operation)) != 0;
+    }
+    bool Marshalling(Parcel &parcel) const override;
+    static ProviderInfo* Unmarshalling(Parcel &parcel);
+    static bool MarshallingList(Parcel &parcel, const std::vector<std::shared_ptr<ProviderInfo>> &providerList);
+    static bool UnmarshallingList(Parcel &parcel, std::vector<std::shared_ptr<ProviderInfo>> &providerList);
+private:
+    int32_t id_ {0};
+    std::string name_;
+    uint32_t capabilities_ {0};
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_PROVIDER_INFO_H
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "change_notifier.h"
+
+#include <algorithm>
+
+#include "file_manager_service_errno.h"
+#include "log.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+ChangeNotifier &ChangeNotifier::GetInstance()
+{
+    static ChangeNotifier instance;
+    return instance;
+}
+
+int ChangeNotifier::Register(const sptr<IRemoteObject> &object, uint32_t tokenId)
+{
+    sptr<IFmsObserver> observer = iface_cast<IFmsObserver>(object);
+    if (observer == nullptr) {
+        ERR_LOG("invalid observer");
+        return FAIL;
+    }
+    lock_guard<mutex> lock(mutex_);
+    size_t callerNum = 0;
+    for (const auto &it : observers_) {
+        if (it.object == object) {
+            return SUCCESS;
+        }
+        if (it.tokenId == tokenId) {
+            callerNum++;
+        }
+    }
+    if (observers_.size() >= MAX_OBSERVER_NUM || callerNum >= MAX_OBSERVER_NUM_PER_CALLER) {
+        ERR_LOG("too many observers %{public}zu, %{public}zu of the caller", observers_.size(), callerNum);
+        return FAIL;
+    }
+    if (deathRecipient_ == nullptr) {
+        deathRecipient_ = new (std::nothrow) ObserverDeathRecipient();
+    }
+    if (deathRecipient_ == nullptr || !object->AddDeathRecipient(deathRecipient_)) {
+        ERR_LOG("add observer death recipient fail");
+        return FAIL;
+    }
+    observers_.push_back({object, observer, tokenId});
+    return SUCCESS;
+}
+
+void ChangeNotifier::Remove(const wptr<IRemoteObject> &object)
+{
+    lock_guard<mutex> lock(mutex_);
+    observers_.erase(remove_if(observers_.begin(), observers_.end(), [&object](const Observer &it) {
+        return it.object.GetRefPtr() == object.GetRefPtr();
+    }), observers_.end());
+}
+
+void ChangeNotifier::Notify(int32_t equipmentId, const string &path)
+{
+    vector<sptr<IFmsObserver>> observers;
+    {
+        lock_guard<mutex> lock(mutex_);
+        for (const auto &it : observers_) {
+            observers.push_back(it.observer);
+        }
+    }
+    // one way calls, a slow client does not hold the caller
+    for (const auto &observer : observers) {
+        observer->OnChange(equipmentId, path);
+    }
+}
+
+size_t ChangeNotifier::Size()
+{
+    lock_guard<mutex> lock(mutex_);
+    return observers_.size();
+}
+
+void ChangeNotifier::ObserverDeathRecipient::OnRemoteDied(const wptr<IRemoteObject> &object)
+{
+    DEBUG_LOG("observer died");
+    ChangeNotifier::GetInstance().Remove(object);
+}
+} // namespace FileManagerService
+} // namespace OHOS
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_CHANGE_NOTIFIER_H
+#define STORAGE_SERVICES_CHANGE_NOTIFIER_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "fms_observer.h"
+#include "iremote_object.h"
+
+namespace OHOS {
+namespace FileManagerService {
+constexpr size_t MAX_OBSERVER_NUM = 64;
+// a client registers one observer per proxy, the bound keeps one caller from taking all the slots
+constexpr size_t MAX_OBSERVER_NUM_PER_CALLER = 4;
+/**
+ * @class ChangeNotifier
+ * Hold the observers registered by clients and push them the changes of listings,
+ * an observer is dropped when its client dies.
+ */
+class ChangeNotifier {
+public:
+    static ChangeNotifier &GetInstance();
+    int Register(const sptr<IRemoteObject> &object, uint32_t tokenId);
+    void Remove(const wptr<IRemoteObject> &object);
+    // path empty means any listing of equipmentId may have changed
+    void Notify(int32_t equipmentId, const std::string &path);
+    size_t Size();
+private:
+    class ObserverDeathRecipient : public IRemoteObject::DeathRecipient {
+    public:
+        void OnRemoteDied(const wptr<IRemoteObject> &object) override;
+    };
+    struct Observer {
+        sptr<IRemoteObject> object;
+        sptr<IFmsObserver> observer;
+        uint32_t tokenId {0};
+    };
+    ChangeNotifier() = default;
+    ~ChangeNotifier() = default;
+
+    std::mutex mutex_;
+    std::vector<Observer> observers_;
+    sptr<IRemoteObject::DeathRecipient> deathRecipient_;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_CHANGE_NOTIFIER_H
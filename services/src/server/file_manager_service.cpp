@@ -15,32 +15,169 @@
 
 #include "file_manager_service.h"
 
+#include <cerrno>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+
+#include "fms_metrics.h"
+#include "idle_monitor.h"
 #include "iservice_registry.h"
 #include "log.h"
+#include "media_file_utils.h"
+#include "parameters.h"
+#include "permission_cache.h"
+#include "request_scheduler.h"
+#include "single_flight.h"
+#include "storage_manager_inf.h"
 #include "system_ability_definition.h"
 #include "ext_storage/ext_storage_subscriber.h"
 
+using namespace std;
 namespace OHOS {
 namespace FileManagerService {
-REGISTER_SYSTEM_ABILITY_BY_ID(FileManagerService, FILE_MANAGER_SERVICE_ID, true);
+namespace {
+const string IDLE_UNLOAD_PARAM = "fms.idle_unload_ms";
+constexpr int32_t IDLE_UNLOAD_MS = 60000;
+constexpr int32_t MAX_IDLE_UNLOAD_MS = 3600000;
+// only the album ids are kept, their paths are queried again on the next start
+const string ALBUM_PATH_CACHE_FILE = "/data/service/el1/public/fms/album_path_cache";
+}
+
+// started by samgr when a client loads it, see IFmsClient::GetFmsInstance
+REGISTER_SYSTEM_ABILITY_BY_ID(FileManagerService, FILE_MANAGER_SERVICE_ID, false);
 
 FileManagerService::FileManagerService(int32_t systemAbilityId, bool runOnCreate)
     : SystemAbility(systemAbilityId, runOnCreate) {}
-void FileManagerService::OnDump() {}
+void FileManagerService::OnDump()
+{
+    RequestScheduler &scheduler = RequestScheduler::GetInstance();
+    INFO_LOG("running %{public}zu, queue depth foreground %{public}zu normal %{public}zu background %{public}zu",
+        scheduler.GetRunningNum(), scheduler.GetQueueDepth(PRIORITY_FOREGROUND),
+        scheduler.GetQueueDepth(PRIORITY_NORMAL), scheduler.GetQueueDepth(PRIORITY_BACKGROUND));
+    INFO_LOG("startup %{public}s, publish cost %{public}lld us", startup_.IsReady() ? "ready" : "warming",
+        static_cast<long long>(startup_.GetPublishCost()));
+    for (const auto &phase : startup_.GetResults()) {
+        INFO_LOG("startup phase %{public}s %{public}s, cost %{public}lld us", phase.name.c_str(),
+            phase.succ ? "done" : "fail", static_cast<long long>(phase.costUs));
+    }
+}
+
+int FileManagerService::Dump(int fd, const vector<u16string> &args)
+{
+    RequestScheduler &scheduler = RequestScheduler::GetInstance();
+    ostringstream ss;
+    ss << "fms_service\n";
+    ss << "startup: " << (startup_.IsReady() ? "ready" : "warming") << ", publish " <<
+        startup_.GetPublishCost() << " us\n";
+    for (const auto &phase : startup_.GetResults()) {
+        ss << "  " << phase.name << ": " << (phase.succ ? "done" : "fail") << ", " << phase.costUs << " us\n";
+    }
+    ss << "in flight: " << IdleMonitor::GetInstance().GetInflightNum() << ", running " <<
+        scheduler.GetRunningNum() << "\n";
+    ss << "queue depth: foreground " << scheduler.GetQueueDepth(PRIORITY_FOREGROUND) << ", normal " <<
+        scheduler.GetQueueDepth(PRIORITY_NORMAL) << ", background " <<
+        scheduler.GetQueueDepth(PRIORITY_BACKGROUND) << "\n";
+    ss << "cache size: permission " << PermissionCache::GetInstance().Size() << ", album_path " <<
+        MediaFileUtils::GetCachedAlbumIds().size() << ", single_flight " << SingleFlight::GetInstance().Size() <<
+        "\n";
+    string out = ss.str();
+    FmsMetrics::GetInstance().Dump(out);
+    if (write(fd, out.c_str(), out.size()) < 0) {
+        ERR_LOG("write dump fail, errno %{public}d", errno);
+        return FAIL;
+    }
+    return SUCCESS;
+}
 
 void FileManagerService::OnStart()
 {
     DEBUG_LOG("FileManagerService OnStart");
-    ExtStorageSubscriber::Subscriber();
+    auto begin = chrono::steady_clock::now();
     bool res = Publish(this);
     if (!res) {
         ERR_LOG("FileManagerService OnStart invalid");
     }
+    startup_.SetPublishCost(
+        chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin).count());
+    // everything below is only warm up, a request arriving before it is done initializes what it needs itself
+    AddStartupPhases();
+    startup_.Start();
+    int32_t idleMs = system::GetIntParameter(IDLE_UNLOAD_PARAM, IDLE_UNLOAD_MS, 0, MAX_IDLE_UNLOAD_MS);
+    IdleMonitor::GetInstance().Start(idleMs, [this] { return UnloadOnIdle(); });
 }
 
 void FileManagerService::OnStop()
 {
     DEBUG_LOG("FileManagerService OnStop");
+    IdleMonitor::GetInstance().Stop();
+    startup_.Wait();
+}
+
+void FileManagerService::AddStartupPhases()
+{
+    sptr<IRemoteObject> obj = AsObject();
+    startup_.AddPhase("media_helper", [obj] { return MediaFileUtils::InitHelper(obj); });
+    // subscribe before the volume table is read so no disk event is missed in between
+    startup_.AddPhase("disk_event", [] { return ExtStorageSubscriber::Subscriber(); });
+    startup_.AddPhase("storage_manager", [] { return StorageManagerInf::Connect() == SUCCESS; });
+    // no disk attached is a valid table
+    startup_.AddPhase("volume_table", [] {
+        vector<StorageManager::VolumeExternal> volumes;
+        return StorageManagerInf::GetAllVolumes(volumes) == SUCCESS;
+    });
+    startup_.AddPhase("album_path_cache", [this] { return RestoreCaches(); });
+}
+
+bool FileManagerService::RestoreCaches()
+{
+    vector<string> ids;
+    ifstream in(ALBUM_PATH_CACHE_FILE);
+    for (string id; getline(in, id);) {
+        ids.push_back(id);
+    }
+    if (ids.empty()) {
+        return true;
+    }
+    if (!MediaFileUtils::InitHelper(AsObject())) {
+        return false;
+    }
+    // saved albums deleted since or a stale file warm nothing, which is no failure of the phase
+    int warmed = MediaFileUtils::WarmAlbumPathCache(ids);
+    INFO_LOG("restore %{public}d of %{public}zu album paths", warmed, ids.size());
+    return true;
+}
+
+void FileManagerService::SaveCaches()
+{
+    vector<string> ids = MediaFileUtils::GetCachedAlbumIds();
+    ofstream out(ALBUM_PATH_CACHE_FILE, ios::trunc);
+    if (!out) {
+        ERR_LOG("open album path cache file fail");
+        return;
+    }
+    for (const auto &id : ids) {
+        out << id << '\n';
+    }
+}
+
+bool FileManagerService::UnloadOnIdle()
+{
+    // clients holding an observer need not pin the service, they drop the proxy and its listing cache
+    // when the service goes away and register again on the next service
+    SaveCaches();
+    auto samgr = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
+    if (samgr == nullptr) {
+        ERR_LOG("samgr object is NULL.");
+        return false;
+    }
+    int32_t ret = samgr->UnloadSystemAbility(FILE_MANAGER_SERVICE_ID);
+    if (ret != ERR_OK) {
+        ERR_LOG("unload fms fail %{public}d", ret);
+        return false;
+    }
+    return true;
 }
 } // namespace FileManagerService
 } // namespace OHOS
\ No newline at end of file
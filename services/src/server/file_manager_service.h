@@ -17,6 +17,7 @@
 
 #include "file_manager_service_stub.h"
 #include "iremote_stub.h"
+#include "startup_pipeline.h"
 #include "system_ability.h"
 
 namespace OHOS {
@@ -28,8 +29,16 @@ public:
     explicit FileManagerService(int32_t systemAbilityId, bool runOnCreate = true);
     virtual ~FileManagerService() = default;
     void OnDump() override;
+    int Dump(int fd, const std::vector<std::u16string> &args) override;
     void OnStart() override;
     void OnStop() override;
+private:
+    void AddStartupPhases();
+    bool RestoreCaches();
+    void SaveCaches();
+    bool UnloadOnIdle();
+
+    StartupPipeline startup_;
 };
 } // namespace FileManagerService
 } // namespace OHOS
@@ -15,21 +15,38 @@
 
 #include "file_manager_service_stub.h"
 
-#include "accesstoken_kit.h"
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "change_notifier.h"
 #include "file_manager_service_def.h"
 #include "file_manager_service_errno.h"
 #include "file_manager_service.h"
+#include "fms_metrics.h"
+#include "fms_trace.h"
+#include "idle_monitor.h"
 #include "ipc_singleton.h"
 #include "ipc_skeleton.h"
 #include "log.h"
 #include "media_file_utils.h"
-#include "oper_factory.h"
+#include "oper_dispatcher.h"
+#include "permission_cache.h"
+#include "rate_limiter.h"
+#include "request_scheduler.h"
+#include "single_flight.h"
 #include "sa_mgr_client.h"
 #include "string_ex.h"
 #include "system_ability_definition.h"
 using namespace std;
 namespace OHOS {
 namespace FileManagerService {
+namespace {
+constexpr int ASYNC_THREAD_NUM = 2;
+constexpr int ASYNC_MAX_TASK_NUM = 64;
+constexpr int LIST_FILE_STRING_ARGS = 4;
+}
+
 static int GetEquipmentCode(uint32_t code)
 {
     return (code >> EQUIPMENT_SHIFT) & CODE_MASK;
@@ -40,57 +57,289 @@ static int GetOperCode(uint32_t code)
     return code & CODE_MASK;
 }
 
-int FileManagerServiceStub::OperProcess(uint32_t code, MessageParcel &data,
+// read the LIST_FILE args: devName, devPath, type, path, offset, count and flags
+static string ReadListFileKey(int equipmentId, MessageParcel &data)
+{
+    string key = to_string(equipmentId);
+    for (int i = 0; i < LIST_FILE_STRING_ARGS; i++) {
+        key += "|" + data.ReadString();
+    }
+    key += "|" + to_string(data.ReadInt64());
+    key += "|" + to_string(data.ReadInt64());
+    key += "|" + to_string(data.ReadUint32());
+    return key;
+}
+
+// index of the path among the leading string args of each operation, 0 when it has none
+static int GetPathArgIndex(int operCode)
+{
+    switch (operCode) {
+        case Operation::GET_ROOT:
+        case Operation::GET_FOLDER_STATS:
+            return 1;
+        case Operation::MAKE_DIR:
+        case Operation::CREATE_FILE:
+            return 2;
+        case Operation::LIST_FILE:
+            return LIST_FILE_STRING_ARGS;
+        default:
+            return 0;
+    }
+}
+
+static string ReadRequestPath(int operCode, MessageParcel &data, size_t argsPos)
+{
+    int index = GetPathArgIndex(operCode);
+    if (index == 0) {
+        return "";
+    }
+    data.RewindRead(argsPos);
+    string path;
+    for (int i = 0; i < index; i++) {
+        path = data.ReadString();
+    }
+    return path;
+}
+
+// operations the proxy sends async, their args are plain data which AsyncProcess can copy
+static bool IsAsyncOperation(int operCode)
+{
+    return operCode == Operation::GET_ROOT || operCode == Operation::LIST_FILE;
+}
+
+// operations whose success changes the listing of their path
+static bool IsListingChange(int operCode)
+{
+    return operCode == Operation::MAKE_DIR || operCode == Operation::CREATE_FILE ||
+        operCode == Operation::CREATE_FILES;
+}
+
+int FileManagerServiceStub::OperProcess(uint32_t code, uint32_t tokenId, MessageParcel &data,
     MessageParcel &reply)
 {
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
     int equipmentId = GetEquipmentCode(code);
     int operCode = GetOperCode(code);
-    OperFactory factory = OperFactory();
-    auto fp = factory.GetFileOper(equipmentId);
-    if (fp == nullptr) {
-        ERR_LOG("OnRemoteRequest inner error %{public}d", code);
+    if (operCode == Operation::BATCH) {
+        return BatchProcess(tokenId, data, reply);
+    }
+    if (operCode == Operation::REGISTER_OBSERVER) {
+        return ChangeNotifier::GetInstance().Register(data.ReadRemoteObject(), tokenId);
+    }
+    if (operCode == Operation::GET_PROVIDERS) {
+        return OperDispatcher::HandleGetProviders(data, reply);
+    }
+    if (operCode == Operation::LIST_FILE) {
+        // identical listings in flight share one run, the args are consumed here and replayed for the run
+        size_t argsPos = data.GetReadPosition();
+        string key = ReadListFileKey(equipmentId, data);
+        return SingleFlight::GetInstance().Do(key, reply, [equipmentId, operCode, tokenId, argsPos, &data,
+            &reply](Parcel &) {
+            data.RewindRead(argsPos);
+            return OperDispatcher::Dispatch(equipmentId, operCode, tokenId, data, reply);
+        });
+    }
+    return OperDispatcher::Dispatch(equipmentId, operCode, tokenId, data, reply);
+}
+
+int FileManagerServiceStub::ScheduledProcess(uint32_t code, uint32_t tokenId, bool isAsync,
+    MessageParcel &data, MessageParcel &reply)
+{
+    auto begin = chrono::steady_clock::now();
+    size_t argsPos = data.GetReadPosition();
+    int err = FAIL;
+    {
+        ScheduledRequest request(RequestScheduler::GetPriority(GetOperCode(code), tokenId, isAsync), tokenId);
+        err = request.GetErr();
+        if (err == SUCCESS) {
+            err = OperProcess(code, tokenId, data, reply);
+        }
+    }
+    int64_t costUs = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin).count();
+    int operCode = GetOperCode(code);
+    if (err == SUCCESS && IsListingChange(operCode)) {
+        ChangeNotifier::GetInstance().Notify(GetEquipmentCode(code), ReadRequestPath(operCode, data, argsPos));
+    }
+    FmsMetrics::GetInstance().RecordRequest(GetEquipmentCode(code), operCode, err, costUs,
+        [operCode, argsPos, &data] { return ReadRequestPath(operCode, data, argsPos); });
+    return err;
+}
+
+int FileManagerServiceStub::BatchProcess(uint32_t tokenId, MessageParcel &data, MessageParcel &reply)
+{
+    bool stopOnError = data.ReadBool();
+    uint32_t num = data.ReadUint32();
+    if (num == 0 || num > MAX_BATCH_REQUEST_NUM) {
+        ERR_LOG("invalid batch request number %{public}u", num);
+        return E_INVALID_FILE_NUMBER;
+    }
+    // each sub request is wrapped as code, size and raw args, and each reply as err, size and raw bytes, so a
+    // sub request which is not handled or reads its args wrongly does not shift the ones after it
+    std::vector<int32_t> errs;
+    std::vector<MessageParcel> subReplies(num);
+    for (uint32_t i = 0; i < num; i++) {
+        uint32_t code = data.ReadUint32();
+        uint32_t size = data.ReadUint32();
+        MessageParcel subData;
+        if (size > 0) {
+            const uint8_t *buffer = data.ReadBuffer(size);
+            if (buffer == nullptr || !subData.WriteBuffer(buffer, size)) {
+                ERR_LOG("read batch request fail, size %{public}u", size);
+                return FAIL;
+            }
+        }
+        int operCode = GetOperCode(code);
+        int32_t err = E_INVALID_OPERCODE;
+        if (operCode == Operation::BATCH) {
+            ERR_LOG("nested batch request");
+        } else if (!RateLimiter::GetInstance().TryAcquire(RateLimiter::GetRateClass(operCode), tokenId)) {
+            // a batch of reads is held to the read rate of the caller like the same reads sent one by one
+            FmsMetrics::GetInstance().RecordRateLimited(operCode);
+            err = E_RATE_LIMITED;
+        } else {
+            err = OperDispatcher::Dispatch(GetEquipmentCode(code), operCode, tokenId, subData,
+                subReplies[i]);
+        }
+        if (err == SUCCESS && IsListingChange(operCode)) {
+            ChangeNotifier::GetInstance().Notify(GetEquipmentCode(code), "");
+        }
+        errs.push_back(err);
+        if (err != SUCCESS && stopOnError) {
+            break;
+        }
+    }
+    reply.WriteUint32(errs.size());
+    for (size_t i = 0; i < errs.size(); i++) {
+        size_t size = subReplies[i].GetDataSize();
+        reply.WriteInt32(errs[i]);
+        reply.WriteUint32(size);
+        if (size > 0 && !reply.WriteBuffer(reinterpret_cast<const void *>(subReplies[i].GetData()), size)) {
+            ERR_LOG("reply write err parcel capacity:%{public}zu", reply.GetDataCapacity());
+            return FAIL;
+        }
+    }
+    return SUCCESS;
+}
+
+FileManagerServiceStub::~FileManagerServiceStub()
+{
+    if (asyncStarted_) {
+        asyncPool_.Stop();
+    }
+}
+
+int FileManagerServiceStub::AsyncProcess(uint32_t code, int32_t traceId, const sptr<IFmsCallback> &callback,
+    MessageParcel &data)
+{
+    // data is released when the transaction returns, the worker runs on a copy of the args
+    auto args = make_shared<MessageParcel>();
+    size_t size = data.GetReadableBytes();
+    if (size > 0 && !args->WriteBuffer(data.ReadBuffer(size), size)) {
+        ERR_LOG("copy async args fail, size %{public}zu", size);
         return FAIL;
     }
-    int errCode = fp->OperProcess(operCode, data, reply);
-    return errCode;
+    call_once(asyncStartFlag_, [this] {
+        asyncPool_.SetMaxTaskNum(ASYNC_MAX_TASK_NUM);
+        asyncPool_.Start(ASYNC_THREAD_NUM);
+        asyncStarted_ = true;
+    });
+    // AddTask would block the binder thread on a full queue, a request over the bound is rejected instead,
+    // queued and running requests together never exceed the queue size so AddTask does not block
+    if (asyncPending_.fetch_add(1) >= ASYNC_MAX_TASK_NUM) {
+        asyncPending_--;
+        ERR_LOG("async queue full");
+        return E_SERVICE_BUSY;
+    }
+    uint32_t tokenId = IPCSkeleton::GetCallingTokenID();
+    // a queued async request keeps the service from going idle
+    IdleMonitor::GetInstance().OnRequestBegin();
+    asyncPool_.AddTask([this, code, tokenId, traceId, args, callback]() {
+        FmsAsyncTrace asyncTrace(FMS_ASYNC_TRACE, traceId);
+        MessageParcel reply;
+        int32_t err = ScheduledProcess(code, tokenId, true, *args, reply);
+        callback->OnResult(err, reply);
+        asyncPending_--;
+        IdleMonitor::GetInstance().OnRequestEnd();
+    });
+    return SUCCESS;
 }
 
 bool CheckClientPermission(const std::string& permissionStr)
 {
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
     Security::AccessToken::AccessTokenID tokenCaller = IPCSkeleton::GetCallingTokenID();
-    int res = Security::AccessToken::AccessTokenKit::VerifyAccessToken(tokenCaller,
-        permissionStr);
-    if (res != Security::AccessToken::PermissionState::PERMISSION_GRANTED) {
+    if (!PermissionCache::GetInstance().VerifyPermission(tokenCaller, permissionStr)) {
         ERR_LOG("Have no media permission");
         return false;
     }
-    ERR_LOG("permission check success");
+    DEBUG_LOG("permission check success");
     return true;
 }
 
+// the result of a request that did not run: an async caller learns it through its callback only,
+// a sync caller gets it as the transaction status which the proxy passes on
+static int ReplyErr(int32_t err, const sptr<IFmsCallback> &callback, MessageParcel &reply)
+{
+    if (callback != nullptr) {
+        MessageParcel result;
+        callback->OnResult(err, result);
+        return SUCCESS;
+    }
+    reply.WriteInt32(err);
+    return err;
+}
+
 int FileManagerServiceStub::OnRemoteRequest(uint32_t code, MessageParcel &data,
     MessageParcel &reply, MessageOption &option)
 {
+    IdleGuard idleGuard;
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
     // check whether request from fms proxy
     if (data.ReadInterfaceToken() != GetDescriptor()) {
         ERR_LOG("reject error remote request");
         reply.WriteInt32(FAIL);
         return FAIL;
     }
+    int32_t traceId = data.ReadInt32();
+    FmsAsyncTrace requestTrace(FMS_REQUEST_TRACE, traceId);
+    bool isAsync = (code & ASYNC_REQUEST_FLAG) != 0;
+    code &= ~ASYNC_REQUEST_FLAG;
+    // the callback comes first so every rejection below reaches an async caller
+    sptr<IFmsCallback> callback = nullptr;
+    if (isAsync) {
+        callback = iface_cast<IFmsCallback>(data.ReadRemoteObject());
+        if (callback == nullptr) {
+            ERR_LOG("invalid async callback");
+            return FAIL;
+        }
+    }
+    int operCode = GetOperCode(code);
+    if (isAsync && !IsAsyncOperation(operCode)) {
+        ERR_LOG("operation %{public}d can not be async", operCode);
+        return ReplyErr(E_INVALID_OPERCODE, callback, reply);
+    }
+    // reject a caller over its rate before anything else is spent on the request
+    if (!RateLimiter::GetInstance().TryAcquire(RateLimiter::GetRateClass(operCode),
+        IPCSkeleton::GetCallingTokenID())) {
+        FmsMetrics::GetInstance().RecordRateLimited(operCode);
+        return ReplyErr(E_RATE_LIMITED, callback, reply);
+    }
     // change permission string after finishing accessToken
     string permission = "ohos.permission.READ_MEDIA";
     if (!CheckClientPermission(permission)) {
         ERR_LOG("checkpermission error FAIL");
-        reply.WriteInt32(FAIL);
-        return FAIL;
+        return ReplyErr(FAIL, callback, reply);
     }
     if (!MediaFileUtils::InitHelper(AsObject())) {
         ERR_LOG("Init MediaLibraryDataAbility Helper error");
-        reply.WriteInt32(FAIL);
-        return FAIL;
+        return ReplyErr(FAIL, callback, reply);
     }
     // do request process
-    int32_t errCode = OperProcess(code, data, reply);
+    if (isAsync) {
+        int32_t errCode = AsyncProcess(code, traceId, callback, data);
+        return errCode == SUCCESS ? SUCCESS : ReplyErr(errCode, callback, reply);
+    }
+    int32_t errCode = ScheduledProcess(code, IPCSkeleton::GetCallingTokenID(), false, data, reply);
     reply.WriteInt32(errCode);
     return errCode;
 }
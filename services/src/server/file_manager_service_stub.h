@@ -15,11 +15,16 @@
 #ifndef STORAGE_FILE_MANAGER_SERVICE_STUB_H
 #define STORAGE_FILE_MANAGER_SERVICE_STUB_H
 
+#include <atomic>
+#include <mutex>
+
+#include "fms_callback.h"
 #include "ipc_types.h"
 #include "iremote_broker.h"
 #include "iremote_proxy.h"
 #include "iremote_stub.h"
 #include "oper_factory.h"
+#include "thread_pool.h"
 
 namespace OHOS {
 namespace FileManagerService {
@@ -31,10 +36,22 @@ public:
 class FileManagerServiceStub : public IRemoteStub<IFileManagerService> {
 public:
     FileManagerServiceStub() = default;
-    virtual ~FileManagerServiceStub() = default;
-    int OperProcess(uint32_t code, MessageParcel &data, MessageParcel &reply);
+    virtual ~FileManagerServiceStub();
+    int OperProcess(uint32_t code, uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
     virtual int OnRemoteRequest(uint32_t code, MessageParcel &data,
         MessageParcel &reply, MessageOption &option) override;
+private:
+    // wait for a slot of RequestScheduler, then run OperProcess
+    int ScheduledProcess(uint32_t code, uint32_t tokenId, bool isAsync, MessageParcel &data, MessageParcel &reply);
+    int BatchProcess(uint32_t tokenId, MessageParcel &data, MessageParcel &reply);
+    // run the request on asyncPool_ and send the reply through callback, an error return was not queued
+    int AsyncProcess(uint32_t code, int32_t traceId, const sptr<IFmsCallback> &callback, MessageParcel &data);
+
+    ThreadPool asyncPool_ {"FmsAsync"};
+    std::once_flag asyncStartFlag_;
+    std::atomic<bool> asyncStarted_ {false};
+    // async requests queued or running on asyncPool_
+    std::atomic<int> asyncPending_ {0};
 };
 } // namespace FileManagerService
 } // namespace OHOS
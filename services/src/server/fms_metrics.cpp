@@ -0,0 +1,273 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fms_metrics.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+#include "file_manager_service_errno.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+namespace {
+constexpr uint32_t PERCENT_50 = 50;
+constexpr uint32_t PERCENT_90 = 90;
+constexpr uint32_t PERCENT_99 = 99;
+constexpr uint32_t PERCENT_ALL = 100;
+const char *OPERATION_NAMES[OPERATION_BUTT] = {
+    "GET_ROOT", "MAKE_DIR", "LIST_FILE", "CREATE_FILE", "GET_FOLDER_STATS", "CREATE_FILES", "BATCH",
+    "REGISTER_OBSERVER", "GET_PROVIDERS"
+};
+const char *EQUIPMENT_NAMES[EQUIPMENT_BUTT] = {"internal", "external", "local_directory"};
+const char *CACHE_NAMES[CACHE_BUTT] = {"permission", "album_path", "prefetch", "single_flight"};
+}
+
+FmsMetrics &FmsMetrics::GetInstance()
+{
+    static FmsMetrics instance;
+    return instance;
+}
+
+FmsMetrics::FmsMetrics()
+{
+    Reset();
+}
+
+FmsMetrics::Shard &FmsMetrics::GetShard()
+{
+    thread_local size_t index = nextShard_.fetch_add(1, memory_order_relaxed) % METRICS_SHARD_NUM;
+    return shards_[index];
+}
+
+size_t FmsMetrics::GetBucket(int64_t costUs)
+{
+    size_t bucket = 0;
+    while (costUs > 1 && bucket < LATENCY_BUCKET_NUM - 1) {
+        costUs >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+void FmsMetrics::RecordRequest(int equipmentId, int operCode, int32_t err, int64_t costUs,
+    const function<string()> &getPath)
+{
+    if (equipmentId < 0 || equipmentId >= EQUIPMENT_BUTT || operCode < 0 || operCode >= OPERATION_BUTT) {
+        return;
+    }
+    Shard &shard = GetShard();
+    shard.requests[equipmentId][operCode].fetch_add(1, memory_order_relaxed);
+    if (err != SUCCESS) {
+        shard.errors[equipmentId][operCode].fetch_add(1, memory_order_relaxed);
+    }
+    shard.latency[operCode][GetBucket(costUs)].fetch_add(1, memory_order_relaxed);
+    if (costUs < SLOW_REQUEST_US) {
+        return;
+    }
+    SlowRequest request = {equipmentId, operCode, err, costUs, getPath == nullptr ? "" : RedactPath(getPath())};
+    lock_guard<mutex> lock(slowMutex_);
+    if (slowRequests_.size() < SLOW_REQUEST_NUM) {
+        slowRequests_.push_back(move(request));
+    } else {
+        slowRequests_[slowNext_] = move(request);
+    }
+    slowNext_ = (slowNext_ + 1) % SLOW_REQUEST_NUM;
+}
+
+void FmsMetrics::RecordCache(MetricsCache cache, bool hit)
+{
+    if (cache < 0 || cache >= CACHE_BUTT) {
+        return;
+    }
+    Shard &shard = GetShard();
+    if (hit) {
+        shard.cacheHit[cache].fetch_add(1, memory_order_relaxed);
+    } else {
+        shard.cacheMiss[cache].fetch_add(1, memory_order_relaxed);
+    }
+}
+
+void FmsMetrics::RecordRateLimited(int operCode)
+{
+    if (operCode < 0 || operCode >= OPERATION_BUTT) {
+        return;
+    }
+    GetShard().rateLimited[operCode].fetch_add(1, memory_order_relaxed);
+}
+
+string FmsMetrics::RedactPath(const string &path)
+{
+    // skip the scheme so "dataability:///album/1" keeps "album"
+    size_t pos = path.find(":///");
+    size_t start = (pos == string::npos) ? 0 : pos + strlen(":///");
+    size_t first = path.find_first_not_of('/', start);
+    if (first == string::npos) {
+        return path;
+    }
+    size_t end = path.find('/', first);
+    if (end == string::npos) {
+        return path;
+    }
+    string redacted = path.substr(0, end);
+    while (end != string::npos) {
+        size_t next = path.find_first_not_of('/', end);
+        if (next == string::npos) {
+            break;
+        }
+        redacted += "/*";
+        end = path.find('/', next);
+    }
+    return redacted;
+}
+
+int64_t FmsMetrics::GetPercentile(const array<uint64_t, LATENCY_BUCKET_NUM> &buckets, uint32_t percent)
+{
+    uint64_t total = 0;
+    for (auto count : buckets) {
+        total += count;
+    }
+    if (total == 0) {
+        return 0;
+    }
+    // rank of the percent-th sample, rounded up
+    uint64_t rank = (total * percent + PERCENT_ALL - 1) / PERCENT_ALL;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < LATENCY_BUCKET_NUM; i++) {
+        seen += buckets[i];
+        if (seen >= rank && buckets[i] > 0) {
+            return static_cast<int64_t>(1) << (i + 1);
+        }
+    }
+    return static_cast<int64_t>(1) << LATENCY_BUCKET_NUM;
+}
+
+void FmsMetrics::DumpRequests(string &out)
+{
+    ostringstream ss;
+    ss << "requests:\n";
+    for (int op = 0; op < OPERATION_BUTT; op++) {
+        array<uint64_t, LATENCY_BUCKET_NUM> buckets {};
+        for (auto &shard : shards_) {
+            for (size_t i = 0; i < LATENCY_BUCKET_NUM; i++) {
+                buckets[i] += shard.latency[op][i].load(memory_order_relaxed);
+            }
+        }
+        for (int eq = 0; eq < EQUIPMENT_BUTT; eq++) {
+            uint64_t requests = 0;
+            uint64_t errors = 0;
+            for (auto &shard : shards_) {
+                requests += shard.requests[eq][op].load(memory_order_relaxed);
+                errors += shard.errors[eq][op].load(memory_order_relaxed);
+            }
+            if (requests > 0) {
+                ss << "  " << OPERATION_NAMES[op] << " " << EQUIPMENT_NAMES[eq] << ": count " << requests <<
+                    ", errors " << errors << "\n";
+            }
+        }
+        uint64_t rateLimited = 0;
+        for (auto &shard : shards_) {
+            rateLimited += shard.rateLimited[op].load(memory_order_relaxed);
+        }
+        if (rateLimited > 0) {
+            ss << "  " << OPERATION_NAMES[op] << " rate limited: " << rateLimited << "\n";
+        }
+        if (GetPercentile(buckets, PERCENT_ALL) > 0) {
+            ss << "  " << OPERATION_NAMES[op] << " latency us: P50 <" << GetPercentile(buckets, PERCENT_50) <<
+                ", P90 <" << GetPercentile(buckets, PERCENT_90) << ", P99 <" <<
+                GetPercentile(buckets, PERCENT_99) << "\n";
+        }
+    }
+    out += ss.str();
+}
+
+void FmsMetrics::DumpCaches(string &out)
+{
+    ostringstream ss;
+    ss << "caches:\n";
+    for (int cache = 0; cache < CACHE_BUTT; cache++) {
+        uint64_t hit = 0;
+        uint64_t miss = 0;
+        for (auto &shard : shards_) {
+            hit += shard.cacheHit[cache].load(memory_order_relaxed);
+            miss += shard.cacheMiss[cache].load(memory_order_relaxed);
+        }
+        uint64_t total = hit + miss;
+        ss << "  " << CACHE_NAMES[cache] << ": hit " << hit << ", miss " << miss << ", hit rate " <<
+            (total == 0 ? 0 : hit * PERCENT_ALL / total) << "%\n";
+    }
+    out += ss.str();
+}
+
+void FmsMetrics::DumpSlowRequests(string &out)
+{
+    vector<SlowRequest> requests;
+    {
+        lock_guard<mutex> lock(slowMutex_);
+        requests = slowRequests_;
+    }
+    sort(requests.begin(), requests.end(), [](const SlowRequest &a, const SlowRequest &b) {
+        return a.costUs > b.costUs;
+    });
+    ostringstream ss;
+    ss << "slow requests (>= " << SLOW_REQUEST_US << " us):\n";
+    for (const auto &request : requests) {
+        ss << "  " << OPERATION_NAMES[request.operCode] << " " << EQUIPMENT_NAMES[request.equipmentId] << " " <<
+            request.costUs << " us, err " << request.err << ", path " << request.path << "\n";
+    }
+    out += ss.str();
+}
+
+void FmsMetrics::Dump(string &out)
+{
+    DumpRequests(out);
+    DumpCaches(out);
+    DumpSlowRequests(out);
+}
+
+void FmsMetrics::Reset()
+{
+    for (auto &shard : shards_) {
+        for (auto &equipment : shard.requests) {
+            for (auto &count : equipment) {
+                count.store(0, memory_order_relaxed);
+            }
+        }
+        for (auto &equipment : shard.errors) {
+            for (auto &count : equipment) {
+                count.store(0, memory_order_relaxed);
+            }
+        }
+        for (auto &count : shard.rateLimited) {
+            count.store(0, memory_order_relaxed);
+        }
+        for (auto &op : shard.latency) {
+            for (auto &count : op) {
+                count.store(0, memory_order_relaxed);
+            }
+        }
+        for (int cache = 0; cache < CACHE_BUTT; cache++) {
+            shard.cacheHit[cache].store(0, memory_order_relaxed);
+            shard.cacheMiss[cache].store(0, memory_order_relaxed);
+        }
+    }
+    lock_guard<mutex> lock(slowMutex_);
+    slowRequests_.clear();
+    slowNext_ = 0;
+}
+} // namespace FileManagerService
+} // namespace OHOS
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_FMS_METRICS_H
+#define STORAGE_SERVICES_FMS_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "file_manager_service_def.h"
+
+namespace OHOS {
+namespace FileManagerService {
+enum MetricsCache {
+    CACHE_PERMISSION,
+    CACHE_ALBUM_PATH,
+    CACHE_PREFETCH,
+    // a hit is a listing served by a run of the same key already in flight
+    CACHE_SINGLE_FLIGHT,
+    CACHE_BUTT
+};
+
+constexpr size_t METRICS_SHARD_NUM = 16;
+// bucket i counts the latencies in [2^i, 2^(i+1)) us, the last one is open ended
+constexpr size_t LATENCY_BUCKET_NUM = 24;
+constexpr size_t SLOW_REQUEST_NUM = 16;
+constexpr int64_t SLOW_REQUEST_US = 50000;
+
+struct SlowRequest {
+    int equipmentId {0};
+    int operCode {0};
+    int32_t err {0};
+    int64_t costUs {0};
+    std::string path;
+};
+
+/**
+ * @class FmsMetrics
+ * Request and cache counters of the service for hidumper. A thread always records into the same shard,
+ * so recording is a few relaxed atomic adds on a cache line no other thread writes in the common case.
+ * The shards are only summed up when dumping.
+ */
+class FmsMetrics {
+public:
+    static FmsMetrics &GetInstance();
+    // path is only read when the request is slow
+    void RecordRequest(int equipmentId, int operCode, int32_t err, int64_t costUs,
+        const std::function<std::string()> &getPath);
+    void RecordCache(MetricsCache cache, bool hit);
+    void RecordRateLimited(int operCode);
+    void Dump(std::string &out);
+    void Reset();
+    // keep the first segment of path, each later segment becomes '*'
+    static std::string RedactPath(const std::string &path);
+    // upper bound in us of the bucket holding the percent-th latency
+    static int64_t GetPercentile(const std::array<uint64_t, LATENCY_BUCKET_NUM> &buckets, uint32_t percent);
+    static size_t GetBucket(int64_t costUs);
+private:
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> requests[EQUIPMENT_BUTT][OPERATION_BUTT];
+        std::atomic<uint64_t> errors[EQUIPMENT_BUTT][OPERATION_BUTT];
+        std::atomic<uint64_t> rateLimited[OPERATION_BUTT];
+        std::atomic<uint64_t> latency[OPERATION_BUTT][LATENCY_BUCKET_NUM];
+        std::atomic<uint64_t> cacheHit[CACHE_BUTT];
+        std::atomic<uint64_t> cacheMiss[CACHE_BUTT];
+    };
+    FmsMetrics();
+    ~FmsMetrics() = default;
+    Shard &GetShard();
+    void DumpRequests(std::string &out);
+    void DumpCaches(std::string &out);
+    void DumpSlowRequests(std::string &out);
+
+    std::array<Shard, METRICS_SHARD_NUM> shards_;
+    std::atomic<size_t> nextShard_ {0};
+    std::mutex slowMutex_;
+    std::vector<SlowRequest> slowRequests_;
+    size_t slowNext_ {0};
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_FMS_METRICS_H
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "idle_monitor.h"
+
+#include "log.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+IdleMonitor &IdleMonitor::GetInstance()
+{
+    static IdleMonitor instance;
+    return instance;
+}
+
+IdleMonitor::~IdleMonitor()
+{
+    Stop();
+}
+
+void IdleMonitor::Start(int32_t idleMs, const IdleFunc &onIdle)
+{
+    lock_guard<mutex> lock(mutex_);
+    if (running_ || idleMs <= 0 || onIdle == nullptr) {
+        return;
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    running_ = true;
+    idleTime_ = chrono::milliseconds(idleMs);
+    onIdle_ = onIdle;
+    lastActive_ = chrono::steady_clock::now();
+    thread_ = thread([this] { Run(); });
+}
+
+void IdleMonitor::Stop()
+{
+    {
+        lock_guard<mutex> lock(mutex_);
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (!thread_.joinable()) {
+        return;
+    }
+    // onIdle may stop the service from the monitor thread itself
+    if (thread_.get_id() == this_thread::get_id()) {
+        thread_.detach();
+    } else {
+        thread_.join();
+    }
+}
+
+void IdleMonitor::OnRequestBegin()
+{
+    lock_guard<mutex> lock(mutex_);
+    inflight_++;
+}
+
+void IdleMonitor::OnRequestEnd()
+{
+    {
+        lock_guard<mutex> lock(mutex_);
+        if (inflight_ > 0) {
+            inflight_--;
+        }
+        lastActive_ = chrono::steady_clock::now();
+        if (inflight_ > 0) {
+            return;
+        }
+    }
+    cv_.notify_all();
+}
+
+size_t IdleMonitor::GetInflightNum()
+{
+    lock_guard<mutex> lock(mutex_);
+    return inflight_;
+}
+
+bool IdleMonitor::CheckIdle(chrono::steady_clock::time_point now)
+{
+    bool stopped = false;
+    {
+        unique_lock<mutex> lock(mutex_);
+        stopped = CheckIdleLocked(lock, now);
+    }
+    if (stopped) {
+        cv_.notify_all();
+    }
+    return stopped;
+}
+
+bool IdleMonitor::CheckIdleLocked(unique_lock<mutex> &lock, chrono::steady_clock::time_point now)
+{
+    if (!running_ || inflight_ > 0 || now < lastActive_ + idleTime_) {
+        return false;
+    }
+    IdleFunc onIdle = onIdle_;
+    lock.unlock();
+    INFO_LOG("service idle for %{public}lld ms", static_cast<long long>(idleTime_.count()));
+    bool stopped = onIdle();
+    lock.lock();
+    if (stopped) {
+        running_ = false;
+        return true;
+    }
+    lastActive_ = now;
+    return false;
+}
+
+void IdleMonitor::Run()
+{
+    unique_lock<mutex> lock(mutex_);
+    while (running_) {
+        if (inflight_ > 0) {
+            cv_.wait(lock, [this] { return !running_ || inflight_ == 0; });
+            continue;
+        }
+        cv_.wait_until(lock, lastActive_ + idleTime_, [this] { return !running_; });
+        if (CheckIdleLocked(lock, chrono::steady_clock::now())) {
+            break;
+        }
+    }
+}
+} // namespace FileManagerService
+} // namespace OHOS
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_IDLE_MONITOR_H
+#define STORAGE_SERVICES_IDLE_MONITOR_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace OHOS {
+namespace FileManagerService {
+// return true when the service is going away, false keeps monitoring
+using IdleFunc = std::function<bool()>;
+
+/**
+ * @class IdleMonitor
+ * Track the requests in flight and call onIdle once no request has run for idleMs.
+ */
+class IdleMonitor {
+public:
+    static IdleMonitor &GetInstance();
+    void Start(int32_t idleMs, const IdleFunc &onIdle);
+    void Stop();
+    void OnRequestBegin();
+    void OnRequestEnd();
+    size_t GetInflightNum();
+    // run onIdle when no request has run for the idle time at now, return true when the service is going away
+    bool CheckIdle(std::chrono::steady_clock::time_point now);
+private:
+    IdleMonitor() = default;
+    ~IdleMonitor();
+    void Run();
+    bool CheckIdleLocked(std::unique_lock<std::mutex> &lock, std::chrono::steady_clock::time_point now);
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::thread thread_;
+    bool running_ {false};
+    std::chrono::milliseconds idleTime_ {0};
+    IdleFunc onIdle_;
+    size_t inflight_ {0};
+    std::chrono::steady_clock::time_point lastActive_;
+};
+
+class IdleGuard {
+public:
+    IdleGuard()
+    {
+        IdleMonitor::GetInstance().OnRequestBegin();
+    }
+    ~IdleGuard()
+    {
+        IdleMonitor::GetInstance().OnRequestEnd();
+    }
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_IDLE_MONITOR_H
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "permission_cache.h"
+
+#include "accesstoken_kit.h"
+#include "fms_metrics.h"
+#include "log.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+using namespace Security::AccessToken;
+
+void PermissionChangeCallback::PermStateChangeCallback(PermStateChangeInfo &result)
+{
+    DEBUG_LOG("permission %{public}s of token changed", result.permissionName.c_str());
+    PermissionCache::GetInstance().Invalidate(result.tokenID);
+}
+
+PermissionCache &PermissionCache::GetInstance()
+{
+    static PermissionCache instance;
+    return instance;
+}
+
+// one caller at a time registers a permission, a failed registration is retried after a while
+bool PermissionCache::ClaimRegistration(const string &permission, chrono::steady_clock::time_point now)
+{
+    Registration &registration = registrations_[permission];
+    if (registration.registered || now < registration.retryTime) {
+        return false;
+    }
+    registration.retryTime = now + chrono::milliseconds(PERMISSION_REGISTER_RETRY_MS);
+    return true;
+}
+
+void PermissionCache::RegisterCallback(const string &permission)
+{
+    PermStateChangeScope scope;
+    scope.permList = { permission };
+    auto callback = make_shared<PermissionChangeCallback>(scope);
+    int ret = AccessTokenKit::RegisterPermStateChangeCallback(callback);
+    if (ret != RET_SUCCESS) {
+        // decisions still expire with the ttl
+        ERR_LOG("register permission state change callback fail %{public}d", ret);
+        return;
+    }
+    lock_guard<mutex> lock(mutex_);
+    registrations_[permission].registered = true;
+}
+
+bool PermissionCache::VerifyPermission(AccessTokenID tokenId, const string &permission)
+{
+    return VerifyPermission(tokenId, permission, chrono::steady_clock::now());
+}
+
+bool PermissionCache::VerifyPermission(AccessTokenID tokenId, const string &permission,
+    chrono::steady_clock::time_point now)
+{
+    bool needRegister = false;
+    Verifier verifier;
+    uint64_t epoch = 0;
+    {
+        lock_guard<mutex> lock(mutex_);
+        needRegister = ClaimRegistration(permission, now);
+        verifier = verifier_;
+    }
+    // the registration is an ipc, other permission checks do not wait for it
+    if (needRegister) {
+        RegisterCallback(permission);
+    }
+    {
+        lock_guard<mutex> lock(mutex_);
+        auto token = decisions_.find(tokenId);
+        if (token != decisions_.end()) {
+            auto decision = token->second.find(permission);
+            if (decision != token->second.end() && now < decision->second.expireTime) {
+                FmsMetrics::GetInstance().RecordCache(CACHE_PERMISSION, true);
+                return decision->second.granted;
+            }
+        }
+        Verifying &verifying = verifying_[tokenId];
+        verifying.refs++;
+        epoch = verifying.epoch;
+    }
+    FmsMetrics::GetInstance().RecordCache(CACHE_PERMISSION, false);
+    bool granted = (verifier != nullptr) ? verifier(tokenId, permission) :
+        AccessTokenKit::VerifyAccessToken(tokenId, permission) == PermissionState::PERMISSION_GRANTED;
+    lock_guard<mutex> lock(mutex_);
+    Verifying &verifying = verifying_[tokenId];
+    bool changed = verifying.epoch != epoch;
+    if (--verifying.refs == 0) {
+        verifying_.erase(tokenId);
+    }
+    // the permission changed during the verify, the decision may be stale
+    if (changed) {
+        return granted;
+    }
+    if (decisions_.size() >= PERMISSION_CACHE_MAX_TOKEN && decisions_.count(tokenId) == 0) {
+        RemoveExpired(now);
+        if (decisions_.size() >= PERMISSION_CACHE_MAX_TOKEN) {
+            decisions_.clear();
+        }
+    }
+    Decision &decision = decisions_[tokenId][permission];
+    decision.granted = granted;
+    decision.expireTime = now + chrono::milliseconds(PERMISSION_CACHE_TTL_MS);
+    return granted;
+}
+
+void PermissionCache::SetVerifier(const Verifier &verifier)
+{
+    lock_guard<mutex> lock(mutex_);
+    verifier_ = verifier;
+    decisions_.clear();
+    for (auto &verifying : verifying_) {
+        verifying.second.epoch++;
+    }
+}
+
+void PermissionCache::RemoveExpired(chrono::steady_clock::time_point now)
+{
+    for (auto token = decisions_.begin(); token != decisions_.end();) {
+        for (auto decision = token->second.begin(); decision != token->second.end();) {
+            if (now >= decision->second.expireTime) {
+                decision = token->second.erase(decision);
+            } else {
+                ++decision;
+            }
+        }
+        if (token->second.empty()) {
+            token = decisions_.erase(token);
+        } else {
+            ++token;
+        }
+    }
+}
+
+void PermissionCache::Invalidate(AccessTokenID tokenId)
+{
+    lock_guard<mutex> lock(mutex_);
+    decisions_.erase(tokenId);
+    auto verifying = verifying_.find(tokenId);
+    if (verifying != verifying_.end()) {
+        verifying->second.epoch++;
+    }
+}
+
+void PermissionCache::Clear()
+{
+    lock_guard<mutex> lock(mutex_);
+    decisions_.clear();
+    for (auto &verifying : verifying_) {
+        verifying.second.epoch++;
+    }
+}
+
+size_t PermissionCache::Size()
+{
+    lock_guard<mutex> lock(mutex_);
+    return decisions_.size();
+}
+} // namespace FileManagerService
+} // namespace OHOS
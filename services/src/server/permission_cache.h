@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef STORAGE_PERMISSION_CACHE_H
+#define STORAGE_PERMISSION_CACHE_H
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "access_token.h"
+#include "perm_state_change_callback_customize.h"
+
+namespace OHOS {
+namespace FileManagerService {
+constexpr int64_t PERMISSION_CACHE_TTL_MS = 10000;
+constexpr size_t PERMISSION_CACHE_MAX_TOKEN = 256;
+constexpr int64_t PERMISSION_REGISTER_RETRY_MS = 60000;
+/**
+ * @class PermissionCache
+ * Cache the permission decision of a calling token for a short time, a permission state
+ * change of the token drops its decisions at once, and a decision verified while the change
+ * landed is not stored.
+ */
+class PermissionCache {
+public:
+    using Verifier = std::function<bool(Security::AccessToken::AccessTokenID, const std::string &)>;
+    static PermissionCache &GetInstance();
+    bool VerifyPermission(Security::AccessToken::AccessTokenID tokenId, const std::string &permission);
+    bool VerifyPermission(Security::AccessToken::AccessTokenID tokenId, const std::string &permission,
+        std::chrono::steady_clock::time_point now);
+    // replace the AccessTokenKit check, nullptr restores it
+    void SetVerifier(const Verifier &verifier);
+    void Invalidate(Security::AccessToken::AccessTokenID tokenId);
+    void Clear();
+    size_t Size();
+private:
+    struct Decision {
+        bool granted {false};
+        std::chrono::steady_clock::time_point expireTime;
+    };
+    // epoch of a token with verifies in flight, Invalidate and Clear bump it
+    struct Verifying {
+        uint64_t epoch {0};
+        uint32_t refs {0};
+    };
+    struct Registration {
+        bool registered {false};
+        std::chrono::steady_clock::time_point retryTime;
+    };
+    PermissionCache() = default;
+    ~PermissionCache() = default;
+    bool ClaimRegistration(const std::string &permission, std::chrono::steady_clock::time_point now);
+    void RegisterCallback(const std::string &permission);
+    void RemoveExpired(std::chrono::steady_clock::time_point now);
+
+    std::mutex mutex_;
+    Verifier verifier_;
+    std::unordered_map<std::string, Registration> registrations_;
+    std::unordered_map<Security::AccessToken::AccessTokenID, std::unordered_map<std::string, Decision>> decisions_;
+    std::unordered_map<Security::AccessToken::AccessTokenID, Verifying> verifying_;
+};
+
+class PermissionChangeCallback : public Security::AccessToken::PermStateChangeCallbackCustomize {
+public:
+    explicit PermissionChangeCallback(const Security::AccessToken::PermStateChangeScope &scope)
+        : PermStateChangeCallbackCustomize(scope) {}
+    ~PermissionChangeCallback() = default;
+    void PermStateChangeCallback(Security::AccessToken::PermStateChangeInfo &result) override;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_PERMISSION_CACHE_H
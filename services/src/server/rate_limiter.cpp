@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rate_limiter.h"
+
+#include <algorithm>
+#include <string>
+
+#include "file_manager_service_def.h"
+#include "log.h"
+#include "parameters.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+namespace {
+constexpr int32_t MAX_RATE_PARAM_VALUE = 100000;
+constexpr uint32_t RATE_CLASS_SHIFT = 32;
+const char *RATE_CLASS_NAMES[RATE_BUTT] = {"read", "write", "bulk"};
+const int32_t DEFAULT_RATES[RATE_BUTT] = {RATE_LIMIT_READ_RATE, RATE_LIMIT_WRITE_RATE, RATE_LIMIT_BULK_RATE};
+const int32_t DEFAULT_BURSTS[RATE_BUTT] = {RATE_LIMIT_READ_BURST, RATE_LIMIT_WRITE_BURST, RATE_LIMIT_BULK_BURST};
+}
+
+RateLimiter &RateLimiter::GetInstance()
+{
+    static RateLimiter instance;
+    return instance;
+}
+
+RateLimiter::RateLimiter()
+{
+    for (int i = 0; i < RATE_BUTT; i++) {
+        string prefix = string("fms.ratelimit.") + RATE_CLASS_NAMES[i];
+        limits_[i].rate = system::GetIntParameter(prefix + ".rate", DEFAULT_RATES[i], 0, MAX_RATE_PARAM_VALUE);
+        limits_[i].burst = system::GetIntParameter(prefix + ".burst", DEFAULT_BURSTS[i], 1, MAX_RATE_PARAM_VALUE);
+        INFO_LOG("rate limit %{public}s rate %{public}u burst %{public}u", RATE_CLASS_NAMES[i],
+            limits_[i].rate, limits_[i].burst);
+    }
+}
+
+RateClass RateLimiter::GetRateClass(int operCode)
+{
+    switch (operCode) {
+        case Operation::MAKE_DIR:
+        case Operation::CREATE_FILE:
+            return RATE_WRITE;
+        case Operation::CREATE_FILES:
+        // the round trip of a batch, each sub request is charged to its own class too
+        case Operation::BATCH:
+            return RATE_BULK;
+        default:
+            return RATE_READ;
+    }
+}
+
+bool RateLimiter::TryAcquire(RateClass rateClass, uint32_t tokenId)
+{
+    return TryAcquire(rateClass, tokenId, chrono::steady_clock::now());
+}
+
+double RateLimiter::Refill(const Limit &limit, Bucket &bucket, chrono::steady_clock::time_point now)
+{
+    double seconds = chrono::duration<double>(now - bucket.last).count();
+    if (seconds > 0) {
+        bucket.tokens = min(static_cast<double>(limit.burst), bucket.tokens + seconds * limit.rate);
+        bucket.last = now;
+    }
+    return bucket.tokens;
+}
+
+bool RateLimiter::TryAcquire(RateClass rateClass, uint32_t tokenId, chrono::steady_clock::time_point now)
+{
+    if (rateClass < 0 || rateClass >= RATE_BUTT) {
+        return true;
+    }
+    lock_guard<mutex> lock(mutex_);
+    const Limit &limit = limits_[rateClass];
+    if (limit.rate == 0) {
+        return true;
+    }
+    uint64_t key = (static_cast<uint64_t>(rateClass) << RATE_CLASS_SHIFT) | tokenId;
+    auto it = buckets_.find(key);
+    if (it == buckets_.end()) {
+        if (buckets_.size() >= RATE_LIMIT_MAX_BUCKET) {
+            RemoveFull(now);
+        }
+        it = buckets_.emplace(key, Bucket {static_cast<double>(limit.burst), now}).first;
+    }
+    if (Refill(limit, it->second, now) < 1) {
+        return false;
+    }
+    it->second.tokens -= 1;
+    return true;
+}
+
+void RateLimiter::RemoveFull(chrono::steady_clock::time_point now)
+{
+    // a full bucket is the same as a missing one, only callers that are still limited are kept
+    for (auto it = buckets_.begin(); it != buckets_.end();) {
+        const Limit &limit = limits_[it->first >> RATE_CLASS_SHIFT];
+        if (Refill(limit, it->second, now) >= limit.burst) {
+            it = buckets_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    if (buckets_.size() >= RATE_LIMIT_MAX_BUCKET) {
+        WARNING_LOG("too many limited callers, reset all buckets");
+        buckets_.clear();
+    }
+}
+
+void RateLimiter::SetLimit(RateClass rateClass, uint32_t rate, uint32_t burst)
+{
+    if (rateClass < 0 || rateClass >= RATE_BUTT) {
+        return;
+    }
+    lock_guard<mutex> lock(mutex_);
+    limits_[rateClass] = {rate, max(burst, 1u)};
+    buckets_.clear();
+}
+
+void RateLimiter::Clear()
+{
+    lock_guard<mutex> lock(mutex_);
+    buckets_.clear();
+}
+
+size_t RateLimiter::Size()
+{
+    lock_guard<mutex> lock(mutex_);
+    return buckets_.size();
+}
+} // namespace FileManagerService
+} // namespace OHOS
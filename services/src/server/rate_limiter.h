@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_RATE_LIMITER_H
+#define STORAGE_SERVICES_RATE_LIMITER_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace OHOS {
+namespace FileManagerService {
+enum RateClass {
+    RATE_READ,
+    RATE_WRITE,
+    RATE_BULK,
+    RATE_BUTT
+};
+
+// default values of the fms.ratelimit.* parameters in etc/fms_service.para, a rate of 0 means no limit
+constexpr int32_t RATE_LIMIT_READ_RATE = 100;
+constexpr int32_t RATE_LIMIT_READ_BURST = 200;
+constexpr int32_t RATE_LIMIT_WRITE_RATE = 20;
+constexpr int32_t RATE_LIMIT_WRITE_BURST = 40;
+constexpr int32_t RATE_LIMIT_BULK_RATE = 5;
+constexpr int32_t RATE_LIMIT_BULK_BURST = 10;
+constexpr size_t RATE_LIMIT_MAX_BUCKET = 512;
+
+/**
+ * @class RateLimiter
+ * Token bucket per calling token and rate class, checked before a request does any work. A bucket holds
+ * up to burst requests and refills with rate requests per second.
+ */
+class RateLimiter {
+public:
+    static RateLimiter &GetInstance();
+    static RateClass GetRateClass(int operCode);
+    bool TryAcquire(RateClass rateClass, uint32_t tokenId);
+    bool TryAcquire(RateClass rateClass, uint32_t tokenId, std::chrono::steady_clock::time_point now);
+    void SetLimit(RateClass rateClass, uint32_t rate, uint32_t burst);
+    void Clear();
+    size_t Size();
+private:
+    struct Limit {
+        uint32_t rate {0};
+        uint32_t burst {0};
+    };
+    struct Bucket {
+        double tokens {0};
+        std::chrono::steady_clock::time_point last;
+    };
+    RateLimiter();
+    ~RateLimiter() = default;
+    double Refill(const Limit &limit, Bucket &bucket, std::chrono::steady_clock::time_point now);
+    void RemoveFull(std::chrono::steady_clock::time_point now);
+
+    std::mutex mutex_;
+    std::array<Limit, RATE_BUTT> limits_;
+    std::unordered_map<uint64_t, Bucket> buckets_;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_RATE_LIMITER_H
@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "request_scheduler.h"
+
+#include "accesstoken_kit.h"
+#include "file_manager_service_def.h"
+#include "fms_trace.h"
+#include "log.h"
+#include "parameters.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+namespace {
+const string MAX_RUNNING_PARAM = "fms.scheduler.max_running";
+const string MAX_BACKGROUND_RUNNING_PARAM = "fms.scheduler.max_background_running";
+const string MAX_QUEUE_DEPTH_PARAM = "fms.scheduler.max_queue_depth";
+const string WAIT_TIMEOUT_PARAM = "fms.scheduler.wait_timeout_ms";
+constexpr int32_t MAX_PARAM_VALUE = 1024;
+constexpr int32_t MAX_WAIT_TIMEOUT_MS = 60000;
+}
+
+RequestScheduler &RequestScheduler::GetInstance()
+{
+    static RequestScheduler instance;
+    return instance;
+}
+
+RequestScheduler::RequestScheduler()
+{
+    maxRunning_ = system::GetIntParameter(MAX_RUNNING_PARAM, SCHEDULER_MAX_RUNNING, 1, MAX_PARAM_VALUE);
+    maxBackgroundRunning_ = system::GetIntParameter(MAX_BACKGROUND_RUNNING_PARAM,
+        SCHEDULER_MAX_BACKGROUND_RUNNING, 1, MAX_PARAM_VALUE);
+    maxQueueDepth_ = system::GetIntParameter(MAX_QUEUE_DEPTH_PARAM, SCHEDULER_MAX_QUEUE_DEPTH, 1, MAX_PARAM_VALUE);
+    waitTimeoutMs_ = system::GetIntParameter(WAIT_TIMEOUT_PARAM, SCHEDULER_WAIT_TIMEOUT_MS, 1, MAX_WAIT_TIMEOUT_MS);
+    INFO_LOG("scheduler running %{public}zu background %{public}zu queue %{public}zu timeout %{public}d",
+        maxRunning_, maxBackgroundRunning_, maxQueueDepth_, waitTimeoutMs_);
+}
+
+RequestPriority RequestScheduler::GetPriority(int operCode, uint32_t tokenId, bool isAsync)
+{
+    int priority = PRIORITY_BACKGROUND;
+    switch (operCode) {
+        case Operation::GET_ROOT:
+        case Operation::MAKE_DIR:
+        case Operation::LIST_FILE:
+        case Operation::CREATE_FILE:
+            priority = PRIORITY_FOREGROUND;
+            break;
+        case Operation::GET_FOLDER_STATS:
+        case Operation::BATCH:
+            priority = PRIORITY_NORMAL;
+            break;
+        default:
+            break;
+    }
+    // native processes only scan in the background, async callers are not waiting on the reply
+    bool isNative = Security::AccessToken::AccessTokenKit::GetTokenTypeFlag(tokenId) ==
+        Security::AccessToken::TOKEN_NATIVE;
+    if ((isAsync || isNative) && priority < PRIORITY_BACKGROUND) {
+        priority++;
+    }
+    return static_cast<RequestPriority>(priority);
+}
+
+bool RequestScheduler::CanRun(RequestPriority priority) const
+{
+    if (totalRunning_ >= maxRunning_) {
+        return false;
+    }
+    return priority != PRIORITY_BACKGROUND || running_[PRIORITY_BACKGROUND] < maxBackgroundRunning_;
+}
+
+bool RequestScheduler::HasWaiter(RequestPriority priority) const
+{
+    for (int i = PRIORITY_FOREGROUND; i <= priority; i++) {
+        if (queues_[i].depth > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int RequestScheduler::Acquire(RequestPriority priority, uint32_t tokenId)
+{
+    BYTRACE_NAME(FMS_TRACE_TAG, __PRETTY_FUNCTION__);
+    unique_lock<mutex> lock(mutex_);
+    // never overtake a waiter of the same or a higher class
+    if (!HasWaiter(priority) && CanRun(priority)) {
+        running_[priority]++;
+        totalRunning_++;
+        return SUCCESS;
+    }
+    WaitQueue &queue = queues_[priority];
+    if (queue.depth >= maxQueueDepth_) {
+        WARNING_LOG("queue of priority %{public}d is full", priority);
+        return E_SERVICE_BUSY;
+    }
+    auto waiter = make_shared<Waiter>();
+    auto &callerWaiters = queue.waiters[tokenId];
+    if (callerWaiters.empty()) {
+        queue.callers.push_back(tokenId);
+    }
+    callerWaiters.push_back(waiter);
+    queue.depth++;
+    if (!cv_.wait_for(lock, chrono::milliseconds(waitTimeoutMs_), [&waiter] { return waiter->granted; })) {
+        RemoveWaiter(priority, tokenId, waiter);
+        WARNING_LOG("wait for priority %{public}d timeout", priority);
+        return E_SERVICE_BUSY;
+    }
+    return SUCCESS;
+}
+
+void RequestScheduler::Release(RequestPriority priority)
+{
+    {
+        lock_guard<mutex> lock(mutex_);
+        running_[priority]--;
+        totalRunning_--;
+        Grant();
+    }
+    cv_.notify_all();
+}
+
+void RequestScheduler::Grant()
+{
+    bool granted = true;
+    while (granted) {
+        granted = false;
+        for (int i = PRIORITY_FOREGROUND; i < PRIORITY_BUTT; i++) {
+            auto priority = static_cast<RequestPriority>(i);
+            WaitQueue &queue = queues_[priority];
+            if (queue.depth == 0 || !CanRun(priority)) {
+                continue;
+            }
+            uint32_t tokenId = queue.callers.front();
+            queue.callers.pop_front();
+            auto &callerWaiters = queue.waiters[tokenId];
+            callerWaiters.front()->granted = true;
+            callerWaiters.pop_front();
+            if (callerWaiters.empty()) {
+                queue.waiters.erase(tokenId);
+            } else {
+                queue.callers.push_back(tokenId);
+            }
+            queue.depth--;
+            running_[priority]++;
+            totalRunning_++;
+            granted = true;
+            break;
+        }
+    }
+}
+
+void RequestScheduler::RemoveWaiter(RequestPriority priority, uint32_t tokenId, const shared_ptr<Waiter> &waiter)
+{
+    WaitQueue &queue = queues_[priority];
+    auto it = queue.waiters.find(tokenId);
+    if (it == queue.waiters.end()) {
+        return;
+    }
+    auto &callerWaiters = it->second;
+    for (auto iter = callerWaiters.begin(); iter != callerWaiters.end(); iter++) {
+        if (*iter == waiter) {
+            callerWaiters.erase(iter);
+            queue.depth--;
+            break;
+        }
+    }
+    if (callerWaiters.empty()) {
+        queue.waiters.erase(it);
+        queue.callers.remove(tokenId);
+    }
+}
+
+size_t RequestScheduler::GetQueueDepth(RequestPriority priority)
+{
+    lock_guard<mutex> lock(mutex_);
+    return queues_[priority].depth;
+}
+
+size_t RequestScheduler::GetRunningNum()
+{
+    lock_guard<mutex> lock(mutex_);
+    return totalRunning_;
+}
+} // namespace FileManagerService
+} // namespace OHOS
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_REQUEST_SCHEDULER_H
+#define STORAGE_SERVICES_REQUEST_SCHEDULER_H
+
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "file_manager_service_errno.h"
+
+namespace OHOS {
+namespace FileManagerService {
+enum RequestPriority {
+    PRIORITY_FOREGROUND,
+    PRIORITY_NORMAL,
+    PRIORITY_BACKGROUND,
+    PRIORITY_BUTT
+};
+
+// default values of the fms.scheduler.* parameters in etc/fms_service.para
+constexpr int32_t SCHEDULER_MAX_RUNNING = 8;
+constexpr int32_t SCHEDULER_MAX_BACKGROUND_RUNNING = 2;
+constexpr int32_t SCHEDULER_MAX_QUEUE_DEPTH = 32;
+constexpr int32_t SCHEDULER_WAIT_TIMEOUT_MS = 5000;
+
+/**
+ * @class RequestScheduler
+ * Admission gate in front of OperProcess. A request runs at once when a slot is free, else it waits in
+ * the queue of its priority class, callers of the same class are served round robin. Background requests
+ * never take more than maxBackgroundRunning_ slots so the rest stay open to the foreground.
+ */
+class RequestScheduler {
+public:
+    static RequestScheduler &GetInstance();
+    static RequestPriority GetPriority(int operCode, uint32_t tokenId, bool isAsync);
+    int Acquire(RequestPriority priority, uint32_t tokenId);
+    void Release(RequestPriority priority);
+    size_t GetQueueDepth(RequestPriority priority);
+    size_t GetRunningNum();
+private:
+    struct Waiter {
+        bool granted {false};
+    };
+    struct WaitQueue {
+        // callers in round robin order, each one has its waiters in arrival order
+        std::list<uint32_t> callers;
+        std::unordered_map<uint32_t, std::deque<std::shared_ptr<Waiter>>> waiters;
+        size_t depth {0};
+    };
+    RequestScheduler();
+    ~RequestScheduler() = default;
+    bool CanRun(RequestPriority priority) const;
+    bool HasWaiter(RequestPriority priority) const;
+    void Grant();
+    void RemoveWaiter(RequestPriority priority, uint32_t tokenId, const std::shared_ptr<Waiter> &waiter);
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::array<WaitQueue, PRIORITY_BUTT> queues_;
+    std::array<size_t, PRIORITY_BUTT> running_ {};
+    size_t totalRunning_ {0};
+    size_t maxRunning_;
+    size_t maxBackgroundRunning_;
+    size_t maxQueueDepth_;
+    int32_t waitTimeoutMs_;
+};
+
+/**
+ * @class ScheduledRequest
+ * Hold a slot of RequestScheduler for the scope, GetErr tells whether the slot was granted.
+ */
+class ScheduledRequest {
+public:
+    ScheduledRequest(RequestPriority priority, uint32_t tokenId) : priority_(priority)
+    {
+        err_ = RequestScheduler::GetInstance().Acquire(priority, tokenId);
+    }
+    ~ScheduledRequest()
+    {
+        if (err_ == SUCCESS) {
+            RequestScheduler::GetInstance().Release(priority_);
+        }
+    }
+    int GetErr() const
+    {
+        return err_;
+    }
+private:
+    RequestPriority priority_;
+    int err_;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_REQUEST_SCHEDULER_H
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "single_flight.h"
+
+#include "file_manager_service_errno.h"
+#include "fms_metrics.h"
+#include "log.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+SingleFlight &SingleFlight::GetInstance()
+{
+    static SingleFlight instance;
+    return instance;
+}
+
+int SingleFlight::Do(const string &key, Parcel &reply, const FlightFunc &func)
+{
+    unique_lock<mutex> lock(mutex_);
+    auto it = calls_.find(key);
+    FmsMetrics::GetInstance().RecordCache(CACHE_SINGLE_FLIGHT, it != calls_.end());
+    if (it != calls_.end()) {
+        shared_ptr<Call> call = it->second;
+        call->waiters++;
+        cv_.wait(lock, [&call] { return call->done; });
+        lock.unlock();
+        if (!call->bytes.empty() && !reply.WriteBuffer(call->bytes.data(), call->bytes.size())) {
+            ERR_LOG("reply write err parcel capacity:%{public}zu", reply.GetDataCapacity());
+            return FAIL;
+        }
+        return call->err;
+    }
+    auto call = make_shared<Call>();
+    calls_.emplace(key, call);
+    lock.unlock();
+
+    size_t start = reply.GetDataSize();
+    int err = func(reply);
+
+    lock.lock();
+    call->err = err;
+    // copy only when someone joined while func was running
+    if (call->waiters > 0) {
+        DEBUG_LOG("coalesced %{public}zu requests", call->waiters);
+        const uint8_t *data = reinterpret_cast<const uint8_t *>(reply.GetData());
+        call->bytes.assign(data + start, data + reply.GetDataSize());
+    }
+    call->done = true;
+    calls_.erase(key);
+    lock.unlock();
+    cv_.notify_all();
+    return err;
+}
+
+size_t SingleFlight::Size()
+{
+    lock_guard<mutex> lock(mutex_);
+    return calls_.size();
+}
+
+size_t SingleFlight::GetWaiterNum(const string &key)
+{
+    lock_guard<mutex> lock(mutex_);
+    auto it = calls_.find(key);
+    return it == calls_.end() ? 0 : it->second->waiters;
+}
+} // namespace FileManagerService
+} // namespace OHOS
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_SINGLE_FLIGHT_H
+#define STORAGE_SERVICES_SINGLE_FLIGHT_H
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "parcel.h"
+
+namespace OHOS {
+namespace FileManagerService {
+using FlightFunc = std::function<int(Parcel &reply)>;
+
+/**
+ * @class SingleFlight
+ * Coalesce concurrent calls of the same key. The first caller runs func into its own reply, the others
+ * wait for it and get a copy of the bytes it wrote together with its return value.
+ */
+class SingleFlight {
+public:
+    static SingleFlight &GetInstance();
+    int Do(const std::string &key, Parcel &reply, const FlightFunc &func);
+    size_t Size();
+    // callers waiting for the run of key
+    size_t GetWaiterNum(const std::string &key);
+private:
+    struct Call {
+        bool done {false};
+        int err {0};
+        std::vector<uint8_t> bytes;
+        size_t waiters {0};
+    };
+    SingleFlight() = default;
+    ~SingleFlight() = default;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::unordered_map<std::string, std::shared_ptr<Call>> calls_;
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_SINGLE_FLIGHT_H
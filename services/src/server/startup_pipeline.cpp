@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "startup_pipeline.h"
+
+#include <chrono>
+
+#include "log.h"
+
+using namespace std;
+namespace OHOS {
+namespace FileManagerService {
+StartupPipeline::~StartupPipeline()
+{
+    Wait();
+}
+
+void StartupPipeline::AddPhase(const string &name, const PhaseFunc &func)
+{
+    lock_guard<mutex> lock(mutex_);
+    phases_.push_back({name, func});
+}
+
+void StartupPipeline::Start()
+{
+    lock_guard<mutex> lock(mutex_);
+    if (thread_.joinable()) {
+        return;
+    }
+    results_.clear();
+    ready_ = false;
+    thread_ = thread([this] { Run(); });
+}
+
+void StartupPipeline::Wait()
+{
+    if (thread_.joinable() && thread_.get_id() != this_thread::get_id()) {
+        thread_.join();
+    }
+}
+
+bool StartupPipeline::IsReady()
+{
+    lock_guard<mutex> lock(mutex_);
+    return ready_;
+}
+
+void StartupPipeline::SetPublishCost(int64_t costUs)
+{
+    lock_guard<mutex> lock(mutex_);
+    publishCostUs_ = costUs;
+}
+
+int64_t StartupPipeline::GetPublishCost()
+{
+    lock_guard<mutex> lock(mutex_);
+    return publishCostUs_;
+}
+
+vector<PhaseResult> StartupPipeline::GetResults()
+{
+    lock_guard<mutex> lock(mutex_);
+    return results_;
+}
+
+void StartupPipeline::Run()
+{
+    vector<Phase> phases;
+    {
+        lock_guard<mutex> lock(mutex_);
+        phases = phases_;
+    }
+    int64_t totalUs = 0;
+    for (const auto &phase : phases) {
+        auto begin = chrono::steady_clock::now();
+        bool succ = phase.func();
+        int64_t costUs = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin).count();
+        totalUs += costUs;
+        INFO_LOG("startup phase %{public}s %{public}s, cost %{public}lld us", phase.name.c_str(),
+            succ ? "done" : "fail", static_cast<long long>(costUs));
+        lock_guard<mutex> lock(mutex_);
+        results_.push_back({phase.name, succ, costUs});
+    }
+    INFO_LOG("startup ready, warm up cost %{public}lld us", static_cast<long long>(totalUs));
+    lock_guard<mutex> lock(mutex_);
+    ready_ = true;
+}
+} // namespace FileManagerService
+} // namespace OHOS
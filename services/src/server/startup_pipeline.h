@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STORAGE_SERVICES_STARTUP_PIPELINE_H
+#define STORAGE_SERVICES_STARTUP_PIPELINE_H
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace OHOS {
+namespace FileManagerService {
+// return false when the phase failed, the phases after it still run
+using PhaseFunc = std::function<bool()>;
+
+struct PhaseResult {
+    std::string name;
+    bool succ {false};
+    int64_t costUs {0};
+};
+
+/**
+ * @class StartupPipeline
+ * Warm up work of the service start. The phases run in the order they are added on one background thread
+ * after the service is published, the cost of each phase is kept for the dump.
+ */
+class StartupPipeline {
+public:
+    StartupPipeline() = default;
+    ~StartupPipeline();
+    void AddPhase(const std::string &name, const PhaseFunc &func);
+    void Start();
+    void Wait();
+    bool IsReady();
+    void SetPublishCost(int64_t costUs);
+    int64_t GetPublishCost();
+    std::vector<PhaseResult> GetResults();
+private:
+    struct Phase {
+        std::string name;
+        PhaseFunc func;
+    };
+    void Run();
+
+    std::mutex mutex_;
+    std::thread thread_;
+    std::vector<Phase> phases_;
+    std::vector<PhaseResult> results_;
+    int64_t publishCostUs_ {0};
+    bool ready_ {false};
+};
+} // namespace FileManagerService
+} // namespace OHOS
+#endif // STORAGE_SERVICES_STARTUP_PIPELINE_H
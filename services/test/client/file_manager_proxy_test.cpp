@@ -19,7 +19,11 @@
 
 #include "ifms_client.h"
 #include "file_manager_proxy.h"
+#include "file_manager_service_errno.h"
+#include "file_manager_service_stub.h"
 #include "fms_manager_proxy_mock.h"
+#include "ipc_skeleton.h"
+#include "rate_limiter.h"
 
 namespace {
 using namespace std;
@@ -82,8 +86,215 @@ HWTEST_F(FileManagerProxyTest, File_Manager_Proxy_Mkdir_0000, testing::ext::Test
     EXPECT_CALL(*mock_, SendRequest(testing::_, testing::_, testing::_, testing::_))
         .Times(1)
         .WillOnce(testing::Invoke(mock_.GetRefPtr(), &FmsManagerProxyMock::InvokeSendRequest));
-    int ret = proxy_->Mkdir(name, path);
-    EXPECT_EQ(ret, 1);
+    int ret = proxy_->Mkdir(name, path, CmdOptions());
+    EXPECT_EQ(ret, ERR_NONE);
     GTEST_LOG_(INFO) << "FileManagerProxyTest-end File_Manager_Proxy_Mkdir_0000";
 }
-} // namespace
\ No newline at end of file
+
+/**
+ * @tc.number: SUB_STORAGE_File_Manager_Proxy_Mkdir_0001
+ * @tc.name: File_Manager_Proxy_Mkdir_0001
+ * @tc.desc: Test function of Mkdir interface, the request code carries the equipment of the device name.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(FileManagerProxyTest, File_Manager_Proxy_Mkdir_0001, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FileManagerProxyTest-begin File_Manager_Proxy_Mkdir_0001";
+    uint32_t code = (static_cast<uint32_t>(Equipment::LOCAL_DIRECTORY) << EQUIPMENT_SHIFT) | Operation::MAKE_DIR;
+    EXPECT_CALL(*mock_, SendRequest(code, testing::_, testing::_, testing::_))
+        .Times(1)
+        .WillOnce(testing::Invoke(mock_.GetRefPtr(), &FmsManagerProxyMock::InvokeSendRequest));
+    CmdOptions option(LOCAL_DIRECTORY_NAME, "", 0, MAX_NUM, false);
+    EXPECT_EQ(proxy_->Mkdir("a", "local_directory:///", option), ERR_NONE);
+    GTEST_LOG_(INFO) << "FileManagerProxyTest-end File_Manager_Proxy_Mkdir_0001";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_File_Manager_Proxy_GetProviders_0000
+ * @tc.name: File_Manager_Proxy_GetProviders_0000
+ * @tc.desc: Test function of resolving an unknown device name, a failed GET_PROVIDERS is not sent again for
+ *           every request.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(FileManagerProxyTest, File_Manager_Proxy_GetProviders_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FileManagerProxyTest-begin File_Manager_Proxy_GetProviders_0000";
+    EXPECT_CALL(*mock_, SendRequest(Operation::GET_PROVIDERS, testing::_, testing::_, testing::_))
+        .Times(1)
+        .WillOnce(testing::Return(FAIL));
+    EXPECT_CALL(*mock_, SendRequest(Operation::MAKE_DIR, testing::_, testing::_, testing::_))
+        .Times(2)
+        .WillRepeatedly(testing::Invoke(mock_.GetRefPtr(), &FmsManagerProxyMock::InvokeSendRequest));
+    CmdOptions option("usb0", "", 0, MAX_NUM, false);
+    EXPECT_EQ(proxy_->Mkdir("a", "dataability:///album", option), ERR_NONE);
+    EXPECT_EQ(proxy_->Mkdir("b", "dataability:///album", option), ERR_NONE);
+    GTEST_LOG_(INFO) << "FileManagerProxyTest-end File_Manager_Proxy_GetProviders_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_File_Manager_Proxy_Batch_0000
+ * @tc.name: File_Manager_Proxy_Batch_0000
+ * @tc.desc: Test function of Batch interface, several operations cost one round trip.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(FileManagerProxyTest, File_Manager_Proxy_Batch_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FileManagerProxyTest-begin File_Manager_Proxy_Batch_0000";
+    CmdOptions option("local", "", 0, MAX_NUM, true);
+    EXPECT_CALL(*mock_, SendRequest(testing::_, testing::_, testing::_, testing::_))
+        .Times(2)
+        .WillRepeatedly(testing::Invoke(mock_.GetRefPtr(), &FmsManagerProxyMock::InvokeSendRequest));
+    std::vector<std::shared_ptr<FileInfo>> fileRes;
+    proxy_->GetRoot(option, fileRes);
+    proxy_->ListFile("album", "dataability:///album", option, fileRes);
+    testing::Mock::VerifyAndClearExpectations(mock_.GetRefPtr());
+
+    EXPECT_CALL(*mock_, SendRequest(Operation::BATCH, testing::_, testing::_, testing::_))
+        .Times(1)
+        .WillOnce(testing::Invoke(mock_.GetRefPtr(), &FmsManagerProxyMock::InvokeBatchSendRequest));
+    std::vector<BatchRequest> requests = {
+        BatchRequest::GetRoot(option),
+        BatchRequest::ListFile("album", "dataability:///album", option),
+    };
+    std::vector<sptr<CmdResponse>> responses;
+    int ret = proxy_->Batch(requests, false, responses);
+    EXPECT_EQ(ret, ERR_NONE);
+    EXPECT_EQ(responses.size(), requests.size());
+    GTEST_LOG_(INFO) << "FileManagerProxyTest-end File_Manager_Proxy_Batch_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_File_Manager_Proxy_ListFileAsync_0000
+ * @tc.name: File_Manager_Proxy_ListFileAsync_0000
+ * @tc.desc: Test function of ListFileAsync interface, the request is one way and the result comes from callback.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(FileManagerProxyTest, File_Manager_Proxy_ListFileAsync_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FileManagerProxyTest-begin File_Manager_Proxy_ListFileAsync_0000";
+    CmdOptions option("local", "", 0, MAX_NUM, true);
+    EXPECT_CALL(*mock_, SendRequest(Operation::LIST_FILE | ASYNC_REQUEST_FLAG, testing::_, testing::_, testing::_))
+        .Times(1)
+        .WillOnce(testing::Invoke(mock_.GetRefPtr(), &FmsManagerProxyMock::InvokeAsyncSendRequest));
+    int result = FAIL;
+    int ret = proxy_->ListFileAsync("album", "dataability:///album", option,
+        [&result](int err, const std::vector<std::shared_ptr<FileInfo>> &fileRes) {
+            result = err;
+        });
+    EXPECT_EQ(ret, ERR_NONE);
+    EXPECT_EQ(result, ERR_NONE);
+    GTEST_LOG_(INFO) << "FileManagerProxyTest-end File_Manager_Proxy_ListFileAsync_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_File_Manager_Proxy_RateLimited_0000
+ * @tc.name: File_Manager_Proxy_RateLimited_0000
+ * @tc.desc: Test function of GetRoot and GetRootAsync interface, a caller over its rate gets E_RATE_LIMITED
+ *           from the return value and from the callback.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(FileManagerProxyTest, File_Manager_Proxy_RateLimited_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FileManagerProxyTest-begin File_Manager_Proxy_RateLimited_0000";
+    sptr<FileManagerServiceStub> stub = new FileManagerServiceStub();
+    EXPECT_CALL(*mock_, SendRequest(testing::_, testing::_, testing::_, testing::_))
+        .Times(2)
+        .WillRepeatedly(testing::Invoke([stub](uint32_t code, MessageParcel &data, MessageParcel &reply,
+            MessageOption &option) {
+            return stub->OnRemoteRequest(code, data, reply, option);
+        }));
+    // the only token of the bucket is taken, the requests below are over the rate
+    RateLimiter::GetInstance().SetLimit(RATE_READ, 1, 1);
+    EXPECT_TRUE(RateLimiter::GetInstance().TryAcquire(RATE_READ, IPCSkeleton::GetCallingTokenID()));
+
+    CmdOptions option("local", "", 0, MAX_NUM, true);
+    std::vector<std::shared_ptr<FileInfo>> fileRes;
+    EXPECT_EQ(proxy_->GetRoot(option, fileRes), E_RATE_LIMITED);
+    int result = FAIL;
+    int ret = proxy_->GetRootAsync(option, [&result](int err, const std::vector<std::shared_ptr<FileInfo>> &) {
+        result = err;
+    });
+    EXPECT_EQ(ret, ERR_NONE);
+    EXPECT_EQ(result, E_RATE_LIMITED);
+
+    RateLimiter::GetInstance().SetLimit(RATE_READ, RATE_LIMIT_READ_RATE, RATE_LIMIT_READ_BURST);
+    RateLimiter::GetInstance().Clear();
+    GTEST_LOG_(INFO) << "FileManagerProxyTest-end File_Manager_Proxy_RateLimited_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_File_Manager_Proxy_Async_0000
+ * @tc.name: File_Manager_Proxy_Async_0000
+ * @tc.desc: Test function of the async flag on an operation the proxy never sends async, the service replies
+ *           E_INVALID_OPERCODE through the callback and runs nothing.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(FileManagerProxyTest, File_Manager_Proxy_Async_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FileManagerProxyTest-begin File_Manager_Proxy_Async_0000";
+    sptr<FileManagerServiceStub> stub = new FileManagerServiceStub();
+    int result = FAIL;
+    sptr<FmsCallbackStub> callback = new FmsCallbackStub([&result](int32_t err, MessageParcel &) {
+        result = err;
+    });
+    vector<uint32_t> codes = { Operation::MAKE_DIR, Operation::BATCH, Operation::REGISTER_OBSERVER };
+    for (uint32_t code : codes) {
+        result = FAIL;
+        MessageParcel data;
+        data.WriteInterfaceToken(stub->GetDescriptor());
+        // trace id
+        data.WriteInt32(0);
+        data.WriteRemoteObject(callback->AsObject());
+        MessageParcel reply;
+        MessageOption option(MessageOption::TF_ASYNC);
+        EXPECT_EQ(stub->OnRemoteRequest(code | ASYNC_REQUEST_FLAG, data, reply, option), SUCCESS);
+        EXPECT_EQ(result, E_INVALID_OPERCODE);
+    }
+    GTEST_LOG_(INFO) << "FileManagerProxyTest-end File_Manager_Proxy_Async_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_File_Manager_Proxy_ListFileCached_0000
+ * @tc.name: File_Manager_Proxy_ListFileCached_0000
+ * @tc.desc: Test function of ListFile interface with LIST_FILE_CACHE, a failed observer registration is not sent
+ *           again for every cached listing.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(FileManagerProxyTest, File_Manager_Proxy_ListFileCached_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FileManagerProxyTest-begin File_Manager_Proxy_ListFileCached_0000";
+    EXPECT_CALL(*mock_, SendRequest(Operation::REGISTER_OBSERVER, testing::_, testing::_, testing::_))
+        .Times(1)
+        .WillOnce(testing::Return(FAIL));
+    EXPECT_CALL(*mock_, SendRequest(Operation::LIST_FILE, testing::_, testing::_, testing::_))
+        .Times(2)
+        .WillRepeatedly(testing::Invoke(mock_.GetRefPtr(), &FmsManagerProxyMock::InvokeSendRequest));
+    CmdOptions option("local", "", 0, MAX_NUM, true);
+    option.SetFlags(ListFileFlag::LIST_FILE_CACHE);
+    vector<shared_ptr<FileInfo>> fileRes;
+    EXPECT_EQ(proxy_->ListFile("file", "dataability:///album", option, fileRes), ERR_NONE);
+    EXPECT_EQ(proxy_->ListFile("file", "dataability:///album", option, fileRes), ERR_NONE);
+    GTEST_LOG_(INFO) << "FileManagerProxyTest-end File_Manager_Proxy_ListFileCached_0000";
+}
+} // namespace
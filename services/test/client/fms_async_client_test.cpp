@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <gtest/gtest.h>
+
+#include "fms_async_client.h"
+
+namespace {
+using namespace std;
+using namespace OHOS;
+using namespace FileManagerService;
+
+class FakeFmsClient : public IFmsClient {
+public:
+    int Mkdir(const string &name, const string &path, const CmdOptions &option) override
+    {
+        return name.empty() ? FAIL : SUCCESS;
+    }
+    int ListFile(const string &type, const string &path, const CmdOptions &option,
+        vector<shared_ptr<FileInfo>> &fileRes) override
+    {
+        unique_lock<mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return !blocked_; });
+        fileRes.push_back(make_shared<FileInfo>("a", path + "/a", type));
+        return SUCCESS;
+    }
+    int ListFileCompact(const string &type, const string &path, const CmdOptions &option,
+        shared_ptr<CompactFileList> &fileList) override
+    {
+        return FAIL;
+    }
+    int GetRoot(const CmdOptions &option, vector<shared_ptr<FileInfo>> &fileRes) override
+    {
+        fileRes.push_back(make_shared<FileInfo>("root", "/", "album"));
+        return SUCCESS;
+    }
+    int CreateFile(const string &path, const string &fileName, const CmdOptions &option, string &uri) override
+    {
+        uri = path + "/" + fileName;
+        return SUCCESS;
+    }
+    int CreateFiles(const string &path, const vector<string> &fileNames, const CmdOptions &option,
+        vector<string> &uris, vector<int32_t> &errs) override
+    {
+        return FAIL;
+    }
+    int GetFolderStats(const string &path, const CmdOptions &option, bool groupByType,
+        vector<shared_ptr<FolderStats>> &statsRes) override
+    {
+        return FAIL;
+    }
+    int Batch(const vector<BatchRequest> &requests, bool stopOnError,
+        vector<sptr<CmdResponse>> &responses) override
+    {
+        return FAIL;
+    }
+    int ListFileAsync(const string &type, const string &path, const CmdOptions &option,
+        const FileListCallback &callback) override
+    {
+        return FAIL;
+    }
+    int GetRootAsync(const CmdOptions &option, const FileListCallback &callback) override
+    {
+        return FAIL;
+    }
+    int GetProviders(vector<shared_ptr<ProviderInfo>> &providerList) override
+    {
+        return FAIL;
+    }
+    void SetBlocked(bool blocked)
+    {
+        {
+            lock_guard<mutex> lock(mutex_);
+            blocked_ = blocked;
+        }
+        cv_.notify_all();
+    }
+private:
+    mutex mutex_;
+    condition_variable cv_;
+    bool blocked_ {false};
+};
+
+class FmsAsyncClientTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "FmsAsyncClientTest code test" << endl;
+    }
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+/**
+ * @tc.number: SUB_STORAGE_fms_async_client_Future_0000
+ * @tc.name: fms_async_client_Future_0000
+ * @tc.desc: Test function of the future variants of GetRoot, ListFile, CreateFile and Mkdir.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(FmsAsyncClientTest, fms_async_client_Future_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsAsyncClientTest-begin fms_async_client_Future_0000";
+    FakeFmsClient fake;
+    FmsAsyncClient client(&fake);
+    CmdOptions option;
+    auto root = client.GetRoot(option);
+    auto list = client.ListFile("file", "/data", option);
+    auto create = client.CreateFile("/data", "b", option);
+    auto mkdir = client.Mkdir("", "/data", option);
+    FileListResult rootRes = root.get();
+    EXPECT_EQ(rootRes.err, SUCCESS);
+    ASSERT_EQ(rootRes.fileRes.size(), 1);
+    EXPECT_EQ(rootRes.fileRes[0]->GetName(), "root");
+    FileListResult listRes = list.get();
+    EXPECT_EQ(listRes.err, SUCCESS);
+    ASSERT_EQ(listRes.fileRes.size(), 1);
+    EXPECT_EQ(listRes.fileRes[0]->GetPath(), "/data/a");
+    UriResult uriRes = create.get();
+    EXPECT_EQ(uriRes.err, SUCCESS);
+    EXPECT_EQ(uriRes.uri, "/data/b");
+    EXPECT_EQ(mkdir.get(), FAIL);
+    GTEST_LOG_(INFO) << "FmsAsyncClientTest-end fms_async_client_Future_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_fms_async_client_Busy_0000
+ * @tc.name: fms_async_client_Busy_0000
+ * @tc.desc: Test function of the bounded queue which rejects requests over its size without blocking.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(FmsAsyncClientTest, fms_async_client_Busy_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsAsyncClientTest-begin fms_async_client_Busy_0000";
+    FakeFmsClient fake;
+    FmsAsyncClient client(&fake, 1);
+    CmdOptions option;
+    fake.SetBlocked(true);
+    auto first = client.ListFile("file", "/data", option);
+    EXPECT_EQ(client.GetPendingNum(), 1);
+    EXPECT_EQ(client.ListFile("file", "/data", option, [](int, const vector<shared_ptr<FileInfo>> &) {}),
+        E_CLIENT_BUSY);
+    EXPECT_EQ(client.Mkdir("a", "/data", option).get(), E_CLIENT_BUSY);
+    fake.SetBlocked(false);
+    EXPECT_EQ(first.get().err, SUCCESS);
+    GTEST_LOG_(INFO) << "FmsAsyncClientTest-end fms_async_client_Busy_0000";
+}
+} // namespace
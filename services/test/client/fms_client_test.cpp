@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+
+#include <gtest/gtest.h>
+
+#include "file_manager_service_errno.h"
+#include "fms_client.h"
+#include "fms_manager_proxy_mock.h"
+
+namespace {
+using namespace std;
+using namespace OHOS;
+using namespace FileManagerService;
+class FmsClientTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "FmsClientTest code test" << endl;
+    }
+    static void TearDownTestCase() {};
+    void SetUp();
+    void TearDown()
+    {
+        FmsClient::GetInstance().SetLoader(nullptr);
+    };
+    // the first load gets dead_, every later one alive_
+    sptr<FmsManagerProxyMock> dead_ = nullptr;
+    sptr<FmsManagerProxyMock> alive_ = nullptr;
+    int loadNum_ = 0;
+};
+
+void FmsClientTest::SetUp()
+{
+    dead_ = new FmsManagerProxyMock();
+    alive_ = new FmsManagerProxyMock();
+    loadNum_ = 0;
+    FmsClient::GetInstance().SetLoader([this]() -> sptr<IRemoteObject> {
+        return (loadNum_++ == 0) ? dead_ : alive_;
+    });
+    // the death shows in the status of the send only, the obituary has not arrived yet
+    EXPECT_CALL(*dead_, SendRequest(testing::_, testing::_, testing::_, testing::_))
+        .Times(1)
+        .WillOnce(testing::Return(ERR_DEAD_OBJECT));
+}
+
+/**
+ * @tc.number: SUB_STORAGE_fms_client_Call_0000
+ * @tc.name: fms_client_Call_0000
+ * @tc.desc: Test function of ListFile interface, a read that failed on a dead service runs again on a new one.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(FmsClientTest, fms_client_Call_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsClientTest-begin fms_client_Call_0000";
+    EXPECT_CALL(*alive_, SendRequest(testing::_, testing::_, testing::_, testing::_))
+        .Times(1)
+        .WillOnce(testing::Invoke(alive_.GetRefPtr(), &FmsManagerProxyMock::InvokeSendRequest));
+    CmdOptions option("local", "", 0, MAX_NUM, false);
+    vector<shared_ptr<FileInfo>> fileRes;
+    EXPECT_EQ(FmsClient::GetInstance().ListFile("file", "dataability:///album", option, fileRes), ERR_NONE);
+    EXPECT_EQ(loadNum_, 2);
+    GTEST_LOG_(INFO) << "FmsClientTest-end fms_client_Call_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_fms_client_Call_0001
+ * @tc.name: fms_client_Call_0001
+ * @tc.desc: Test function of Mkdir interface, a write that failed on a dead service is not run again and the
+ *           next call loads a new service.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(FmsClientTest, fms_client_Call_0001, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsClientTest-begin fms_client_Call_0001";
+    EXPECT_CALL(*alive_, SendRequest(testing::_, testing::_, testing::_, testing::_))
+        .Times(1)
+        .WillOnce(testing::Invoke(alive_.GetRefPtr(), &FmsManagerProxyMock::InvokeSendRequest));
+    EXPECT_EQ(FmsClient::GetInstance().Mkdir("a", "dataability:///album", CmdOptions()), E_SERVICE_DIED);
+    EXPECT_EQ(loadNum_, 1);
+    EXPECT_EQ(FmsClient::GetInstance().Mkdir("a", "dataability:///album", CmdOptions()), ERR_NONE);
+    EXPECT_EQ(loadNum_, 2);
+    GTEST_LOG_(INFO) << "FmsClientTest-end fms_client_Call_0001";
+}
+} // namespace
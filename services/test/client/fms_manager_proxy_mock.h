@@ -21,6 +21,7 @@
 #include "iremote_proxy.h"
 #include "ifms_client.h"
 #include "cmd_response.h"
+#include "fms_callback.h"
 
 namespace OHOS {
 namespace FileManagerService {
@@ -36,7 +37,44 @@ public:
         reply.WriteParcelable(cmdResponse);
         return ERR_NONE;
     }
-    virtual int Mkdir(const std::string &name, const std::string &path) override
+    int32_t InvokeAsyncSendRequest(uint32_t code, MessageParcel &data, MessageParcel &reply,
+        MessageOption &option)
+    {
+        data.ReadInterfaceToken();
+        // trace id
+        data.ReadInt32();
+        sptr<IFmsCallback> callback = iface_cast<IFmsCallback>(data.ReadRemoteObject());
+        if (callback == nullptr) {
+            return ERR_NONE;
+        }
+        MessageParcel result;
+        sptr<CmdResponse> cmdResponse = new CmdResponse();
+        cmdResponse->SetErr(ERR_NONE);
+        result.WriteParcelable(cmdResponse);
+        callback->OnResult(ERR_NONE, result);
+        return ERR_NONE;
+    }
+    int32_t InvokeBatchSendRequest(uint32_t code, MessageParcel &data, MessageParcel &reply,
+        MessageOption &option)
+    {
+        data.ReadInterfaceToken();
+        // trace id
+        data.ReadInt32();
+        data.ReadBool();
+        uint32_t num = data.ReadUint32();
+        reply.WriteUint32(num);
+        for (uint32_t i = 0; i < num; i++) {
+            MessageParcel subReply;
+            sptr<CmdResponse> cmdResponse = new CmdResponse();
+            cmdResponse->SetErr(ERR_NONE);
+            subReply.WriteParcelable(cmdResponse);
+            reply.WriteInt32(ERR_NONE);
+            reply.WriteUint32(subReply.GetDataSize());
+            reply.WriteBuffer(reinterpret_cast<const void *>(subReply.GetData()), subReply.GetDataSize());
+        }
+        return ERR_NONE;
+    }
+    virtual int Mkdir(const std::string &name, const std::string &path, const CmdOptions &option) override
     {
         return ERR_NONE;
     }
@@ -45,6 +83,11 @@ public:
     {
         return ERR_NONE;
     }
+    virtual int ListFileCompact(const std::string &type, const std::string &path, const CmdOptions &option,
+        std::shared_ptr<CompactFileList> &fileList) override
+    {
+        return ERR_NONE;
+    }
     virtual int GetRoot(const CmdOptions &option, std::vector<std::shared_ptr<FileInfo>> &fileRes) override
     {
         return ERR_NONE;
@@ -54,6 +97,34 @@ public:
     {
         return ERR_NONE;
     }
+    virtual int CreateFiles(const std::string &path, const std::vector<std::string> &fileNames,
+        const CmdOptions &option, std::vector<std::string> &uris, std::vector<int32_t> &errs) override
+    {
+        return ERR_NONE;
+    }
+    virtual int GetFolderStats(const std::string &path, const CmdOptions &option, bool groupByType,
+        std::vector<std::shared_ptr<FolderStats>> &statsRes) override
+    {
+        return ERR_NONE;
+    }
+    virtual int Batch(const std::vector<BatchRequest> &requests, bool stopOnError,
+        std::vector<sptr<CmdResponse>> &responses) override
+    {
+        return ERR_NONE;
+    }
+    virtual int ListFileAsync(const std::string &type, const std::string &path, const CmdOptions &option,
+        const FileListCallback &callback) override
+    {
+        return ERR_NONE;
+    }
+    virtual int GetRootAsync(const CmdOptions &option, const FileListCallback &callback) override
+    {
+        return ERR_NONE;
+    }
+    virtual int GetProviders(std::vector<std::shared_ptr<ProviderInfo>> &providerList) override
+    {
+        return ERR_NONE;
+    }
 };
 }  // namespace FileManagerService
 }  // namespace OHOS
@@ -0,0 +1,279 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <cstdio>
+#include <gtest/gtest.h>
+
+#include "list_file_iterator.h"
+
+namespace {
+using namespace std;
+using namespace OHOS;
+using namespace FileManagerService;
+
+// folder of fileNum entries, paged by offset and count like the service
+class FakeFmsClient : public IFmsClient {
+public:
+    explicit FakeFmsClient(int64_t fileNum) : fileNum_(fileNum) {}
+    // the next request at offset fails once
+    void FailOnce(int64_t offset)
+    {
+        failOffset_ = offset;
+    }
+    int Mkdir(const string &name, const string &path, const CmdOptions &option) override
+    {
+        return FAIL;
+    }
+    int ListFile(const string &type, const string &path, const CmdOptions &option,
+        vector<shared_ptr<FileInfo>> &fileRes) override
+    {
+        if (option.GetCount() > MAX_NUM) {
+            return E_INVALID_FILE_NUMBER;
+        }
+        int64_t failOffset = option.GetOffset();
+        if (failOffset_.compare_exchange_strong(failOffset, -1)) {
+            return FAIL;
+        }
+        if (option.GetOffset() >= fileNum_) {
+            return E_EMPTYFOLDER;
+        }
+        int64_t end = min(fileNum_, option.GetOffset() + option.GetCount());
+        for (int64_t i = option.GetOffset(); i < end; i++) {
+            fileRes.push_back(make_shared<FileInfo>(to_string(i), path + "/" + to_string(i), type));
+        }
+        return SUCCESS;
+    }
+    int ListFileCompact(const string &type, const string &path, const CmdOptions &option,
+        shared_ptr<CompactFileList> &fileList) override
+    {
+        return FAIL;
+    }
+    int GetRoot(const CmdOptions &option, vector<shared_ptr<FileInfo>> &fileRes) override
+    {
+        return FAIL;
+    }
+    int CreateFile(const string &path, const string &fileName, const CmdOptions &option, string &uri) override
+    {
+        return FAIL;
+    }
+    int CreateFiles(const string &path, const vector<string> &fileNames, const CmdOptions &option,
+        vector<string> &uris, vector<int32_t> &errs) override
+    {
+        return FAIL;
+    }
+    int GetFolderStats(const string &path, const CmdOptions &option, bool groupByType,
+        vector<shared_ptr<FolderStats>> &statsRes) override
+    {
+        return FAIL;
+    }
+    int Batch(const vector<BatchRequest> &requests, bool stopOnError,
+        vector<sptr<CmdResponse>> &responses) override
+    {
+        return FAIL;
+    }
+    int ListFileAsync(const string &type, const string &path, const CmdOptions &option,
+        const FileListCallback &callback) override
+    {
+        return FAIL;
+    }
+    int GetRootAsync(const CmdOptions &option, const FileListCallback &callback) override
+    {
+        return FAIL;
+    }
+    int GetProviders(vector<shared_ptr<ProviderInfo>> &providerList) override
+    {
+        return FAIL;
+    }
+private:
+    int64_t fileNum_;
+    atomic<int64_t> failOffset_ {-1};
+};
+
+class ListFileIteratorTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "ListFileIteratorTest code test" << endl;
+    }
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+/**
+ * @tc.number: SUB_STORAGE_list_file_iterator_Next_0000
+ * @tc.name: list_file_iterator_Next_0000
+ * @tc.desc: Test function of Next interface with a page size above MAX_NUM.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(ListFileIteratorTest, list_file_iterator_Next_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ListFileIteratorTest-begin list_file_iterator_Next_0000";
+    FakeFmsClient fake(MAX_NUM * 2 + 50);
+    FmsAsyncClient client(&fake);
+    CmdOptions option("local", "", 0, MAX_NUM, true);
+    ListFileIterator it("file", "/data", option, MAX_NUM + MAX_NUM / 2, client);
+    vector<shared_ptr<FileInfo>> fileRes;
+    EXPECT_EQ(it.Next(fileRes), SUCCESS);
+    ASSERT_EQ(fileRes.size(), MAX_NUM + MAX_NUM / 2);
+    EXPECT_EQ(fileRes[MAX_NUM]->GetName(), to_string(MAX_NUM));
+    EXPECT_TRUE(it.HasNext());
+    EXPECT_EQ(it.Next(fileRes), SUCCESS);
+    ASSERT_EQ(fileRes.size(), MAX_NUM / 2 + 50);
+    EXPECT_EQ(fileRes.back()->GetName(), to_string(MAX_NUM * 2 + 49));
+    EXPECT_FALSE(it.HasNext());
+    EXPECT_EQ(it.GetToken(), "");
+    EXPECT_EQ(it.Next(fileRes), SUCCESS);
+    EXPECT_TRUE(fileRes.empty());
+    GTEST_LOG_(INFO) << "ListFileIteratorTest-end list_file_iterator_Next_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_list_file_iterator_Next_0001
+ * @tc.name: list_file_iterator_Next_0001
+ * @tc.desc: Test function of Next interface for a folder ending at a page boundary.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(ListFileIteratorTest, list_file_iterator_Next_0001, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ListFileIteratorTest-begin list_file_iterator_Next_0001";
+    FakeFmsClient fake(MAX_NUM * 2);
+    FmsAsyncClient client(&fake);
+    CmdOptions option("local", "", 0, MAX_NUM, true);
+    ListFileIterator it("file", "/data", option, MAX_NUM, client);
+    vector<shared_ptr<FileInfo>> fileRes;
+    size_t total = 0;
+    while (it.HasNext()) {
+        ASSERT_EQ(it.Next(fileRes), SUCCESS);
+        total += fileRes.size();
+    }
+    EXPECT_EQ(total, MAX_NUM * 2);
+    GTEST_LOG_(INFO) << "ListFileIteratorTest-end list_file_iterator_Next_0001";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_list_file_iterator_Seek_0000
+ * @tc.name: list_file_iterator_Seek_0000
+ * @tc.desc: Test function of Seek interface which continues from the token of another iterator.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(ListFileIteratorTest, list_file_iterator_Seek_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ListFileIteratorTest-begin list_file_iterator_Seek_0000";
+    FakeFmsClient fake(MAX_NUM);
+    FmsAsyncClient client(&fake);
+    CmdOptions option("local", "", 0, MAX_NUM, true);
+    vector<shared_ptr<FileInfo>> fileRes;
+    ListFileIterator first("file", "/data", option, 10, client);
+    EXPECT_EQ(first.Next(fileRes), SUCCESS);
+    string token = first.GetToken();
+    ListFileIterator second("file", "/data", option, 10, client);
+    EXPECT_FALSE(second.Seek("10"));
+    EXPECT_TRUE(second.Seek(token));
+    EXPECT_EQ(second.Next(fileRes), SUCCESS);
+    ASSERT_EQ(fileRes.size(), 10);
+    EXPECT_EQ(fileRes[0]->GetName(), "10");
+    GTEST_LOG_(INFO) << "ListFileIteratorTest-end list_file_iterator_Seek_0000";
+}
+/**
+ * @tc.number: SUB_STORAGE_list_file_iterator_Next_0002
+ * @tc.name: list_file_iterator_Next_0002
+ * @tc.desc: Test function of Next interface when a later request of a page fails, the retry returns the whole
+ *           page from its start.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(ListFileIteratorTest, list_file_iterator_Next_0002, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ListFileIteratorTest-begin list_file_iterator_Next_0002";
+    FakeFmsClient fake(MAX_NUM * 3);
+    fake.FailOnce(MAX_NUM);
+    FmsAsyncClient client(&fake);
+    CmdOptions option("local", "", 0, MAX_NUM, true);
+    ListFileIterator it("file", "/data", option, MAX_NUM * 2, client);
+    vector<shared_ptr<FileInfo>> fileRes;
+    EXPECT_EQ(it.Next(fileRes), FAIL);
+    EXPECT_TRUE(fileRes.empty());
+    EXPECT_TRUE(it.HasNext());
+    EXPECT_EQ(it.GetToken(), "v1:0");
+    EXPECT_EQ(it.Next(fileRes), SUCCESS);
+    ASSERT_EQ(fileRes.size(), MAX_NUM * 2);
+    EXPECT_EQ(fileRes.front()->GetName(), "0");
+    EXPECT_EQ(fileRes.back()->GetName(), to_string(MAX_NUM * 2 - 1));
+    EXPECT_EQ(it.Next(fileRes), SUCCESS);
+    ASSERT_EQ(fileRes.size(), MAX_NUM);
+    EXPECT_EQ(fileRes.front()->GetName(), to_string(MAX_NUM * 2));
+    GTEST_LOG_(INFO) << "ListFileIteratorTest-end list_file_iterator_Next_0002";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_list_file_iterator_Next_0003
+ * @tc.name: list_file_iterator_Next_0003
+ * @tc.desc: Test function of Next interface for an empty folder, the first page is empty and ends the walk.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(ListFileIteratorTest, list_file_iterator_Next_0003, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ListFileIteratorTest-begin list_file_iterator_Next_0003";
+    FakeFmsClient fake(0);
+    FmsAsyncClient client(&fake);
+    CmdOptions option("local", "", 0, MAX_NUM, true);
+    ListFileIterator it("file", "/data", option, MAX_NUM, client);
+    vector<shared_ptr<FileInfo>> fileRes;
+    EXPECT_EQ(it.Next(fileRes), SUCCESS);
+    EXPECT_TRUE(fileRes.empty());
+    EXPECT_FALSE(it.HasNext());
+    EXPECT_EQ(it.GetToken(), "");
+    GTEST_LOG_(INFO) << "ListFileIteratorTest-end list_file_iterator_Next_0003";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_list_file_iterator_Next_0004
+ * @tc.name: list_file_iterator_Next_0004
+ * @tc.desc: Test function of Next interface with a page of more requests than the client executor queues.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(ListFileIteratorTest, list_file_iterator_Next_0004, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ListFileIteratorTest-begin list_file_iterator_Next_0004";
+    constexpr int64_t requestNum = CLIENT_MAX_TASK_NUM + 8;
+    FakeFmsClient fake(MAX_NUM * requestNum);
+    FmsAsyncClient client(&fake);
+    CmdOptions option("local", "", 0, MAX_NUM, true);
+    ListFileIterator it("file", "/data", option, MAX_NUM * requestNum, client);
+    vector<shared_ptr<FileInfo>> fileRes;
+    EXPECT_EQ(it.Next(fileRes), SUCCESS);
+    EXPECT_EQ(fileRes.size(), MAX_NUM * requestNum);
+    GTEST_LOG_(INFO) << "ListFileIteratorTest-end list_file_iterator_Next_0004";
+}
+} // namespace
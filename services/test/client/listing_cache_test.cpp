@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <gtest/gtest.h>
+
+#include "file_manager_service_def.h"
+#include "listing_cache.h"
+
+namespace {
+using namespace std;
+using namespace OHOS;
+using namespace FileManagerService;
+constexpr int64_t TEST_TTL_MS = 60000;
+class ListingCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "ListingCacheTest code test" << endl;
+    }
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+vector<shared_ptr<FileInfo>> GetFileRes(const string &name)
+{
+    return { make_shared<FileInfo>(name, "/data/" + name, "file") };
+}
+
+/**
+ * @tc.number: SUB_STORAGE_listing_cache_Get_0000
+ * @tc.name: listing_cache_Get_0000
+ * @tc.desc: Test function of Get interface for SUCCESS after Put and for FAIL after the ttl.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(ListingCacheTest, listing_cache_Get_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ListingCacheTest-begin listing_cache_Get_0000";
+    ListingCache cache(2, TEST_TTL_MS);
+    vector<shared_ptr<FileInfo>> fileRes;
+    string key = ListingCache::MakeKey(0, "file", "/data", 0, MAX_NUM, 0);
+    EXPECT_FALSE(cache.Get(key, fileRes));
+    cache.Put(key, 0, "/data", GetFileRes("a"), cache.GetGeneration());
+    EXPECT_TRUE(cache.Get(key, fileRes));
+    ASSERT_EQ(fileRes.size(), 1);
+    EXPECT_EQ(fileRes[0]->GetName(), "a");
+    EXPECT_FALSE(cache.Get(key, fileRes, chrono::steady_clock::now() + chrono::milliseconds(TEST_TTL_MS + 1)));
+    EXPECT_EQ(cache.Size(), 0);
+    GTEST_LOG_(INFO) << "ListingCacheTest-end listing_cache_Get_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_listing_cache_MakeKey_0000
+ * @tc.name: listing_cache_MakeKey_0000
+ * @tc.desc: Test function of MakeKey interface which ignores the client side flags.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(ListingCacheTest, listing_cache_MakeKey_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ListingCacheTest-begin listing_cache_MakeKey_0000";
+    string key = ListingCache::MakeKey(0, "file", "/data", 0, MAX_NUM, 0);
+    EXPECT_EQ(key, ListingCache::MakeKey(0, "file", "/data", 0, MAX_NUM,
+        ListFileFlag::LIST_FILE_CACHE | ListFileFlag::LIST_FILE_COMPACT));
+    EXPECT_NE(key, ListingCache::MakeKey(1, "file", "/data", 0, MAX_NUM, 0));
+    EXPECT_NE(key, ListingCache::MakeKey(0, "file", "/data", MAX_NUM, MAX_NUM, 0));
+    EXPECT_NE(key, ListingCache::MakeKey(0, "file", "/data", 0, MAX_NUM, ListFileFlag::LIST_FILE_PREFETCH));
+    GTEST_LOG_(INFO) << "ListingCacheTest-end listing_cache_MakeKey_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_listing_cache_Put_0000
+ * @tc.name: listing_cache_Put_0000
+ * @tc.desc: Test function of Put interface which evicts the least recently used entry.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(ListingCacheTest, listing_cache_Put_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ListingCacheTest-begin listing_cache_Put_0000";
+    ListingCache cache(2);
+    vector<shared_ptr<FileInfo>> fileRes;
+    cache.Put("1", 0, "/a", GetFileRes("a"), cache.GetGeneration());
+    cache.Put("2", 0, "/b", GetFileRes("b"), cache.GetGeneration());
+    EXPECT_TRUE(cache.Get("1", fileRes));
+    cache.Put("3", 0, "/c", GetFileRes("c"), cache.GetGeneration());
+    EXPECT_EQ(cache.Size(), 2);
+    EXPECT_TRUE(cache.Get("1", fileRes));
+    EXPECT_FALSE(cache.Get("2", fileRes));
+    EXPECT_TRUE(cache.Get("3", fileRes));
+    GTEST_LOG_(INFO) << "ListingCacheTest-end listing_cache_Put_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_listing_cache_Invalidate_0000
+ * @tc.name: listing_cache_Invalidate_0000
+ * @tc.desc: Test function of Invalidate interface for a path, for a whole equipment and for a listing in flight.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(ListingCacheTest, listing_cache_Invalidate_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ListingCacheTest-begin listing_cache_Invalidate_0000";
+    ListingCache cache(4);
+    vector<shared_ptr<FileInfo>> fileRes;
+    cache.Put("1", 0, "/a", GetFileRes("a"), cache.GetGeneration());
+    cache.Put("2", 0, "/b", GetFileRes("b"), cache.GetGeneration());
+    cache.Put("3", 1, "/a", GetFileRes("a"), cache.GetGeneration());
+    cache.Invalidate(0, "/a");
+    EXPECT_FALSE(cache.Get("1", fileRes));
+    EXPECT_TRUE(cache.Get("2", fileRes));
+    EXPECT_TRUE(cache.Get("3", fileRes));
+    uint64_t generation = cache.GetGeneration();
+    cache.Invalidate(0, "");
+    EXPECT_FALSE(cache.Get("2", fileRes));
+    EXPECT_TRUE(cache.Get("3", fileRes));
+    cache.Put("4", 0, "/d", GetFileRes("d"), generation);
+    EXPECT_FALSE(cache.Get("4", fileRes));
+    EXPECT_EQ(cache.Size(), 1);
+    GTEST_LOG_(INFO) << "ListingCacheTest-end listing_cache_Invalidate_0000";
+}
+} // namespace
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <gtest/gtest.h>
+
+#include "album_path_cache.h"
+
+namespace {
+using namespace std;
+using namespace OHOS;
+using namespace FileManagerService;
+class AlbumPathCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "AlbumPathCacheTest code test" << endl;
+    }
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+/**
+ * @tc.number: SUB_STORAGE_album_path_cache_Get_0000
+ * @tc.name: album_path_cache_Get_0000
+ * @tc.desc: Test function of Get interface for SUCCESS after Put.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(AlbumPathCacheTest, album_path_cache_Get_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AlbumPathCacheTest-begin album_path_cache_Get_0000";
+    AlbumPathCache cache(2);
+    string path;
+    EXPECT_FALSE(cache.Get("1", path));
+    cache.Put("1", "Pictures/", cache.GetGeneration());
+    EXPECT_TRUE(cache.Get("1", path));
+    EXPECT_EQ(path, "Pictures/");
+    GTEST_LOG_(INFO) << "AlbumPathCacheTest-end album_path_cache_Get_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_album_path_cache_Put_0000
+ * @tc.name: album_path_cache_Put_0000
+ * @tc.desc: Test function of Put interface which evicts the least recently used entry.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(AlbumPathCacheTest, album_path_cache_Put_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AlbumPathCacheTest-begin album_path_cache_Put_0000";
+    AlbumPathCache cache(2);
+    string path;
+    cache.Put("1", "Pictures/", cache.GetGeneration());
+    cache.Put("2", "Music/", cache.GetGeneration());
+    EXPECT_TRUE(cache.Get("1", path));
+    cache.Put("3", "Movies/", cache.GetGeneration());
+    EXPECT_EQ(cache.Size(), 2);
+    EXPECT_TRUE(cache.Get("1", path));
+    EXPECT_FALSE(cache.Get("2", path));
+    EXPECT_TRUE(cache.Get("3", path));
+    GTEST_LOG_(INFO) << "AlbumPathCacheTest-end album_path_cache_Put_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_album_path_cache_Clear_0000
+ * @tc.name: album_path_cache_Clear_0000
+ * @tc.desc: Test function of Clear interface which also drops the entry queried before it.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(AlbumPathCacheTest, album_path_cache_Clear_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AlbumPathCacheTest-begin album_path_cache_Clear_0000";
+    AlbumPathCache cache(2);
+    string path;
+    cache.Put("1", "Pictures/", cache.GetGeneration());
+    uint64_t generation = cache.GetGeneration();
+    cache.Clear();
+    EXPECT_FALSE(cache.Get("1", path));
+    cache.Put("2", "Music/", generation);
+    EXPECT_FALSE(cache.Get("2", path));
+    EXPECT_EQ(cache.Size(), 0);
+    GTEST_LOG_(INFO) << "AlbumPathCacheTest-end album_path_cache_Clear_0000";
+}
+} // namespace
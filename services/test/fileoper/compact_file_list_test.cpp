@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <gtest/gtest.h>
+
+#include "compact_file_list.h"
+
+namespace {
+using namespace std;
+using namespace OHOS;
+using namespace FileManagerService;
+class CompactFileListTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "CompactFileListTest code test" << endl;
+    }
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+/**
+ * @tc.number: SUB_STORAGE_compact_file_list_ReadFromParcel_0000
+ * @tc.name: compact_file_list_ReadFromParcel_0000
+ * @tc.desc: Test function of ReadFromParcel interface, the entries written by CompactFileListWriter come back.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(CompactFileListTest, compact_file_list_ReadFromParcel_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "CompactFileListTest-begin compact_file_list_ReadFromParcel_0000";
+    const string dir = "dataability:///external_storage/mnt/sdcard/DCIM/";
+    CompactFileListWriter writer;
+    writer.Add(dir + "a.jpg", "a.jpg", "file", 1024, 1650000000, 1650000100);
+    writer.Add(dir + "Camera", "Camera", "album", 4096, 1640000000, 1640000000);
+    writer.Add(dir + "b/1", "b.jpg", "file", 0, 1650000050, 1650000050);
+    Parcel parcel;
+    EXPECT_TRUE(writer.WriteToParcel(parcel));
+
+    shared_ptr<CompactFileList> fileList = CompactFileList::ReadFromParcel(parcel);
+    ASSERT_NE(fileList, nullptr);
+    EXPECT_EQ(fileList->Count(), 3u);
+    const auto &fileInfoList = fileList->GetFileInfoList();
+    ASSERT_EQ(fileInfoList.size(), 3u);
+    EXPECT_EQ(fileInfoList[0]->GetPath(), dir + "a.jpg");
+    EXPECT_EQ(fileInfoList[0]->GetSize(), 1024);
+    EXPECT_EQ(fileInfoList[0]->GetModifiedTime(), 1650000100);
+    EXPECT_EQ(fileInfoList[1]->GetType(), "album");
+    EXPECT_EQ(fileInfoList[1]->GetAddedTime(), 1640000000);
+    EXPECT_EQ(fileInfoList[2]->GetPath(), dir + "b/1");
+    EXPECT_EQ(fileInfoList[2]->GetName(), "b.jpg");
+    EXPECT_EQ(fileInfoList[2]->GetType(), "file");
+    GTEST_LOG_(INFO) << "CompactFileListTest-end compact_file_list_ReadFromParcel_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_compact_file_list_ReadFromParcel_0001
+ * @tc.name: compact_file_list_ReadFromParcel_0001
+ * @tc.desc: Test function of ReadFromParcel interface for an unknown version.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(CompactFileListTest, compact_file_list_ReadFromParcel_0001, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "CompactFileListTest-begin compact_file_list_ReadFromParcel_0001";
+    Parcel parcel;
+    parcel.WriteUint32(COMPACT_FILE_LIST_VERSION + 1);
+    EXPECT_EQ(CompactFileList::ReadFromParcel(parcel), nullptr);
+    GTEST_LOG_(INFO) << "CompactFileListTest-end compact_file_list_ReadFromParcel_0001";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_compact_file_list_ReadFromParcel_0002
+ * @tc.name: compact_file_list_ReadFromParcel_0002
+ * @tc.desc: Test function of ReadFromParcel interface, a path out of the prefix of the first entry comes back
+ *           and a count larger than the entries fails the decode.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(CompactFileListTest, compact_file_list_ReadFromParcel_0002, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "CompactFileListTest-begin compact_file_list_ReadFromParcel_0002";
+    CompactFileListWriter writer;
+    writer.Add("/storage/a/x.txt", "x.txt", "file", 1, 0, 0);
+    writer.Add("/storage/b/y.txt", "y.txt", "file", 2, 0, 0);
+    Parcel parcel;
+    EXPECT_TRUE(writer.WriteToParcel(parcel));
+    shared_ptr<CompactFileList> fileList = CompactFileList::ReadFromParcel(parcel);
+    ASSERT_NE(fileList, nullptr);
+    const auto &fileInfoList = fileList->GetFileInfoList();
+    ASSERT_EQ(fileInfoList.size(), 2u);
+    EXPECT_EQ(fileInfoList[0]->GetPath(), "/storage/a/x.txt");
+    EXPECT_EQ(fileInfoList[1]->GetPath(), "/storage/b/y.txt");
+    EXPECT_EQ(fileInfoList[1]->GetSize(), 2);
+
+    Parcel bad;
+    bad.WriteUint32(COMPACT_FILE_LIST_VERSION);
+    bad.WriteUint32(UINT32_MAX);
+    bad.WriteString("");
+    bad.WriteStringVector({"file"});
+    bad.WriteUint32(0);
+    fileList = CompactFileList::ReadFromParcel(bad);
+    ASSERT_NE(fileList, nullptr);
+    EXPECT_TRUE(fileList->GetFileInfoList().empty());
+    GTEST_LOG_(INFO) << "CompactFileListTest-end compact_file_list_ReadFromParcel_0002";
+}
+} // namespace
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "external_storage_utils.h"
+#include "file_manager_service_errno.h"
+#include "media_data_ability_const.h"
+
+namespace {
+using namespace std;
+using namespace OHOS;
+using namespace FileManagerService;
+class ExternalStorageUtilsTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "ExternalStorageUtilsTest code test" << endl;
+    }
+    static void TearDownTestCase() {};
+    void SetUp()
+    {
+        char dir[] = "/tmp/fms_external_storage_XXXXXX";
+        ASSERT_NE(mkdtemp(dir), nullptr);
+        dir_ = dir;
+        WriteFile("a", "12345");
+        WriteFile("b", "123");
+        ASSERT_EQ(mkdir((dir_ + "/d").c_str(), S_IRWXU), 0);
+        ASSERT_EQ(symlink((dir_ + "/a").c_str(), (dir_ + "/l").c_str()), 0);
+    }
+    void TearDown()
+    {
+        string cmd = "rm -rf " + dir_;
+        system(cmd.c_str());
+    }
+    void WriteFile(const string &name, const string &content)
+    {
+        int fd = open((dir_ + "/" + name).c_str(), O_CREAT | O_WRONLY, S_IRUSR | S_IWUSR);
+        ASSERT_GE(fd, 0);
+        EXPECT_EQ(write(fd, content.data(), content.size()), static_cast<ssize_t>(content.size()));
+        close(fd);
+    }
+    string dir_;
+};
+
+/**
+ * @tc.number: SUB_STORAGE_external_storage_utils_GetDirStats_0000
+ * @tc.name: external_storage_utils_GetDirStats_0000
+ * @tc.desc: Test function of GetDirStats interface which counts only the regular files.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(ExternalStorageUtilsTest, external_storage_utils_GetDirStats_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ExternalStorageUtilsTest-begin external_storage_utils_GetDirStats_0000";
+    vector<shared_ptr<FolderStats>> statsList;
+    EXPECT_EQ(ExternalStorageUtils::GetDirStats(dir_, false, statsList), SUCCESS);
+    ASSERT_EQ(statsList.size(), 1);
+    EXPECT_EQ(statsList[0]->GetMediaType(), ALL_MEDIA_TYPE);
+    EXPECT_EQ(statsList[0]->GetCount(), 2);
+    EXPECT_EQ(statsList[0]->GetTotalSize(), 8);
+    GTEST_LOG_(INFO) << "ExternalStorageUtilsTest-end external_storage_utils_GetDirStats_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_external_storage_utils_GetDirStats_0001
+ * @tc.name: external_storage_utils_GetDirStats_0001
+ * @tc.desc: Test function of GetDirStats interface which counts directories as album without their size.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(ExternalStorageUtilsTest, external_storage_utils_GetDirStats_0001, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ExternalStorageUtilsTest-begin external_storage_utils_GetDirStats_0001";
+    vector<shared_ptr<FolderStats>> statsList;
+    EXPECT_EQ(ExternalStorageUtils::GetDirStats(dir_, true, statsList), SUCCESS);
+    ASSERT_EQ(statsList.size(), 2);
+    EXPECT_EQ(statsList[0]->GetMediaType(), Media::MediaType::MEDIA_TYPE_FILE);
+    EXPECT_EQ(statsList[0]->GetCount(), 2);
+    EXPECT_EQ(statsList[0]->GetTotalSize(), 8);
+    EXPECT_EQ(statsList[1]->GetMediaType(), Media::MediaType::MEDIA_TYPE_ALBUM);
+    EXPECT_EQ(statsList[1]->GetCount(), 1);
+    EXPECT_EQ(statsList[1]->GetTotalSize(), 0);
+    statsList.clear();
+    EXPECT_EQ(ExternalStorageUtils::GetDirStats(dir_ + "/none", true, statsList), E_NOEXIST);
+    GTEST_LOG_(INFO) << "ExternalStorageUtilsTest-end external_storage_utils_GetDirStats_0001";
+}
+} // namespace
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "file_manager_service_def.h"
+#include "file_manager_service_errno.h"
+#include "local_directory_utils.h"
+
+namespace {
+using namespace std;
+using namespace OHOS;
+using namespace FileManagerService;
+class LocalDirectoryUtilsTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "LocalDirectoryUtilsTest code test" << endl;
+    }
+    static void TearDownTestCase() {};
+    void SetUp()
+    {
+        char rootDir[] = "/tmp/fms_local_directory_XXXXXX";
+        ASSERT_NE(mkdtemp(rootDir), nullptr);
+        rootDir_ = rootDir;
+        LocalDirectoryUtils::SetRootDir(rootDir_);
+    }
+    void TearDown()
+    {
+        string cmd = "rm -rf " + rootDir_;
+        system(cmd.c_str());
+    }
+    string rootDir_;
+};
+
+/**
+ * @tc.number: SUB_STORAGE_local_directory_utils_GetRoot_0000
+ * @tc.name: local_directory_utils_GetRoot_0000
+ * @tc.desc: Test function of DoGetRoot interface which replies the root directory.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(LocalDirectoryUtilsTest, local_directory_utils_GetRoot_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "LocalDirectoryUtilsTest-begin local_directory_utils_GetRoot_0000";
+    vector<shared_ptr<FileInfo>> fileList;
+    EXPECT_EQ(LocalDirectoryUtils::DoGetRoot(fileList), SUCCESS);
+    ASSERT_EQ(fileList.size(), 1);
+    EXPECT_EQ(fileList[0]->GetPath(), LOCAL_DIRECTORY_URI + rootDir_);
+    EXPECT_EQ(fileList[0]->GetType(), ALBUM_TYPE);
+    GTEST_LOG_(INFO) << "LocalDirectoryUtilsTest-end local_directory_utils_GetRoot_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_local_directory_utils_ListFile_0000
+ * @tc.name: local_directory_utils_ListFile_0000
+ * @tc.desc: Test function of DoListFile interface which pages the sorted entries by offset and count.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(LocalDirectoryUtilsTest, local_directory_utils_ListFile_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "LocalDirectoryUtilsTest-begin local_directory_utils_ListFile_0000";
+    string uri = LOCAL_DIRECTORY_URI + rootDir_;
+    vector<string> uris;
+    vector<int32_t> errs;
+    EXPECT_EQ(LocalDirectoryUtils::DoCreateFiles(uri, {"c", "a", "b"}, uris, errs), SUCCESS);
+    EXPECT_EQ(errs, vector<int32_t>({SUCCESS, SUCCESS, SUCCESS}));
+    EXPECT_EQ(LocalDirectoryUtils::DoMkdir("d", uri), SUCCESS);
+    vector<shared_ptr<FileInfo>> fileList;
+    CmdOptions option(LOCAL_DIRECTORY_NAME, "", 1, 2, true);
+    EXPECT_EQ(LocalDirectoryUtils::DoListFile("file", uri, option, fileList), SUCCESS);
+    ASSERT_EQ(fileList.size(), 2);
+    EXPECT_EQ(fileList[0]->GetName(), "b");
+    EXPECT_EQ(fileList[1]->GetName(), "c");
+    fileList.clear();
+    option.SetOffset(3);
+    EXPECT_EQ(LocalDirectoryUtils::DoListFile("file", uri, option, fileList), SUCCESS);
+    ASSERT_EQ(fileList.size(), 1);
+    EXPECT_EQ(fileList[0]->GetType(), ALBUM_TYPE);
+    EXPECT_EQ(fileList[0]->GetPath(), uri + "/d");
+    GTEST_LOG_(INFO) << "LocalDirectoryUtilsTest-end local_directory_utils_ListFile_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_local_directory_utils_CreateFile_0000
+ * @tc.name: local_directory_utils_CreateFile_0000
+ * @tc.desc: Test function of DoCreateFile interface for FAIL which exists, escapes the root or has a bad name.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(LocalDirectoryUtilsTest, local_directory_utils_CreateFile_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "LocalDirectoryUtilsTest-begin local_directory_utils_CreateFile_0000";
+    string uri = LOCAL_DIRECTORY_URI + rootDir_;
+    string resultUri;
+    EXPECT_EQ(LocalDirectoryUtils::DoCreateFile(uri, "a", resultUri), SUCCESS);
+    EXPECT_EQ(resultUri, uri + "/a");
+    struct stat fileStat {};
+    ASSERT_EQ(stat((rootDir_ + "/a").c_str(), &fileStat), 0);
+    EXPECT_EQ(fileStat.st_mode & (S_IXUSR | S_IXGRP | S_IXOTH), 0);
+    EXPECT_EQ(LocalDirectoryUtils::DoCreateFile(uri, "a", resultUri), E_CREATE_FAIL);
+    EXPECT_EQ(LocalDirectoryUtils::DoCreateFile(uri, "..", resultUri), E_NOEXIST);
+    EXPECT_EQ(LocalDirectoryUtils::DoCreateFile(uri + "/..", "a", resultUri), E_NOEXIST);
+    EXPECT_EQ(LocalDirectoryUtils::DoCreateFile(EXTERNAL_STORAGE_URI + rootDir_, "b", resultUri), E_NOEXIST);
+    GTEST_LOG_(INFO) << "LocalDirectoryUtilsTest-end local_directory_utils_CreateFile_0000";
+}
+} // namespace
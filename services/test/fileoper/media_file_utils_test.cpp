@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <gtest/gtest.h>
+
+#include "file_manager_service_def.h"
+#include "file_manager_service_errno.h"
+#include "media_file_utils.h"
+
+namespace {
+using namespace std;
+using namespace OHOS;
+using namespace FileManagerService;
+class MediaFileUtilsTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "MediaFileUtilsTest code test" << endl;
+    }
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+/**
+ * @tc.number: SUB_STORAGE_media_file_utils_GetRoot_0000
+ * @tc.name: media_file_utils_GetRoot_0000
+ * @tc.desc: Test function of DoGetRoot interface which replies the static root albums without a query.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(MediaFileUtilsTest, media_file_utils_GetRoot_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MediaFileUtilsTest-begin media_file_utils_GetRoot_0000";
+    vector<shared_ptr<FileInfo>> fileList;
+    EXPECT_EQ(MediaFileUtils::DoGetRoot("name", FISRT_LEVEL_ALBUM, fileList), SUCCESS);
+    ASSERT_EQ(fileList.size(), 4);
+    EXPECT_EQ(fileList[0]->GetName(), IMAGE_ROOT_NAME);
+    EXPECT_EQ(fileList[3]->GetName(), FILE_ROOT_NAME);
+    for (auto &fileInfo : fileList) {
+        EXPECT_EQ(fileInfo->GetPath(), FISRT_LEVEL_ALBUM);
+        EXPECT_EQ(fileInfo->GetType(), ALBUM_TYPE);
+    }
+    GTEST_LOG_(INFO) << "MediaFileUtilsTest-end media_file_utils_GetRoot_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_media_file_utils_BatchInsert_0000
+ * @tc.name: media_file_utils_BatchInsert_0000
+ * @tc.desc: Test function of DoBatchInsert interface for FAIL which album uri is invalid, every item fails.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(MediaFileUtilsTest, media_file_utils_BatchInsert_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MediaFileUtilsTest-begin media_file_utils_BatchInsert_0000";
+    vector<string> names = { "media_file_utils_BatchInsert_0000.jpg", "media_file_utils_BatchInsert_0000.txt" };
+    vector<string> uris;
+    vector<int32_t> errs;
+    EXPECT_EQ(MediaFileUtils::DoBatchInsert(names, FISRT_LEVEL_ALBUM + "/invalid", uris, errs), E_NOEXIST);
+    EXPECT_EQ(uris, vector<string>(names.size(), ""));
+    EXPECT_EQ(errs, vector<int32_t>(names.size(), E_CREATE_FAIL));
+    GTEST_LOG_(INFO) << "MediaFileUtilsTest-end media_file_utils_BatchInsert_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_media_file_utils_Mkdir_0000
+ * @tc.name: media_file_utils_Mkdir_0000
+ * @tc.desc: Test function of DoMkdir interface for FAIL which nested name has an invalid level.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(MediaFileUtilsTest, media_file_utils_Mkdir_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MediaFileUtilsTest-begin media_file_utils_Mkdir_0000";
+    EXPECT_EQ(MediaFileUtils::DoMkdir("", FISRT_LEVEL_ALBUM), E_CREATE_FAIL);
+    EXPECT_EQ(MediaFileUtils::DoMkdir("a//b", FISRT_LEVEL_ALBUM), E_CREATE_FAIL);
+    EXPECT_EQ(MediaFileUtils::DoMkdir("a/b/", FISRT_LEVEL_ALBUM), E_CREATE_FAIL);
+    EXPECT_EQ(MediaFileUtils::DoMkdir("a/../b", FISRT_LEVEL_ALBUM), E_CREATE_FAIL);
+    EXPECT_EQ(MediaFileUtils::DoMkdir("./a", FISRT_LEVEL_ALBUM), E_CREATE_FAIL);
+    GTEST_LOG_(INFO) << "MediaFileUtilsTest-end media_file_utils_Mkdir_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_media_file_utils_Mkdir_0001
+ * @tc.name: media_file_utils_Mkdir_0001
+ * @tc.desc: Test function of DoMkdir interface for FAIL which is too deep or parent album uri is invalid.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(MediaFileUtilsTest, media_file_utils_Mkdir_0001, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MediaFileUtilsTest-begin media_file_utils_Mkdir_0001";
+    string name = "a";
+    for (int i = 0; i < MAX_NUM; i++) {
+        name += "/a";
+    }
+    EXPECT_EQ(MediaFileUtils::DoMkdir(name, FISRT_LEVEL_ALBUM), E_CREATE_FAIL);
+    EXPECT_EQ(MediaFileUtils::DoMkdir("a/b", FISRT_LEVEL_ALBUM + "/invalid"), E_NOEXIST);
+    GTEST_LOG_(INFO) << "MediaFileUtilsTest-end media_file_utils_Mkdir_0001";
+}
+} // namespace
@@ -16,8 +16,12 @@
 #include <cstdio>
 #include <gtest/gtest.h>
 
+#include "cmd_response.h"
 #include "file_manager_service_def.h"
+#include "file_manager_service_errno.h"
 #include "file_manager_service_stub.h"
+#include "local_directory_utils.h"
+#include "oper_dispatcher.h"
 #include "media_data_ability_const.h"
 #include "abs_shared_result_set.h"
 
@@ -50,7 +54,7 @@ HWTEST_F(OperFactoryTest, oper_factory_GetFileOper_0000, testing::ext::TestSize.
     GTEST_LOG_(INFO) << "OperFactoryTest-begin oper_factory_GetFileOper_0000";
     try {
         OperFactory *oper = new OperFactory();
-        std::unique_ptr<FileOper> result;
+        const FileOper *result = nullptr;
         if (oper != nullptr) {
             result = oper->GetFileOper(Equipment::INTERNAL_STORAGE);
         }
@@ -75,7 +79,7 @@ HWTEST_F(OperFactoryTest, oper_factory_GetFileOper_0001, testing::ext::TestSize.
     GTEST_LOG_(INFO) << "OperFactoryTest-begin oper_factory_GetFileOper_0001";
     try {
         OperFactory *oper = new OperFactory();
-        std::unique_ptr<FileOper> result;
+        const FileOper *result = nullptr;
         if (oper != nullptr) {
             result = oper->GetFileOper(Equipment::EXTERNAL_STORAGE);
         }
@@ -100,7 +104,7 @@ HWTEST_F(OperFactoryTest, oper_factory_GetFileOper_0002, testing::ext::TestSize.
     GTEST_LOG_(INFO) << "OperFactoryTest-begin oper_factory_GetFileOper_0002";
     try {
         OperFactory *oper = new OperFactory();
-        std::unique_ptr<FileOper> result;
+        const FileOper *result = nullptr;
         if (oper != nullptr) {
             result = oper->GetFileOper(3);
         }
@@ -110,4 +114,115 @@ HWTEST_F(OperFactoryTest, oper_factory_GetFileOper_0002, testing::ext::TestSize.
     }
     GTEST_LOG_(INFO) << "OperFactoryTest-end oper_factory_GetFileOper_0002";
 }
+
+/**
+ * @tc.number: SUB_STORAGE_oper_dispatcher_GetHandler_0000
+ * @tc.name: oper_dispatcher_GetHandler_0000
+ * @tc.desc: Test function of GetHandler interface for SUCCESS which registered operation.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(OperFactoryTest, oper_dispatcher_GetHandler_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "OperFactoryTest-begin oper_dispatcher_GetHandler_0000";
+    EXPECT_NE(OperDispatcher::GetHandler(Equipment::INTERNAL_STORAGE, Operation::LIST_FILE), nullptr);
+    EXPECT_NE(OperDispatcher::GetHandler(Equipment::EXTERNAL_STORAGE, Operation::LIST_FILE), nullptr);
+    GTEST_LOG_(INFO) << "OperFactoryTest-end oper_dispatcher_GetHandler_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_oper_dispatcher_GetHandler_0001
+ * @tc.name: oper_dispatcher_GetHandler_0001
+ * @tc.desc: Test function of GetHandler interface for FAIL which unregistered or invalid operation.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(OperFactoryTest, oper_dispatcher_GetHandler_0001, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "OperFactoryTest-begin oper_dispatcher_GetHandler_0001";
+    EXPECT_EQ(OperDispatcher::GetHandler(Equipment::EXTERNAL_STORAGE, Operation::MAKE_DIR), nullptr);
+    EXPECT_EQ(OperDispatcher::GetHandler(Equipment::EQUIPMENT_BUTT, Operation::LIST_FILE), nullptr);
+    EXPECT_EQ(OperDispatcher::GetHandler(Equipment::INTERNAL_STORAGE, Operation::OPERATION_BUTT), nullptr);
+    GTEST_LOG_(INFO) << "OperFactoryTest-end oper_dispatcher_GetHandler_0001";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_oper_dispatcher_GetProviders_0000
+ * @tc.name: oper_dispatcher_GetProviders_0000
+ * @tc.desc: Test function of GetProviders interface which replies stable ids and registered capabilities.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(OperFactoryTest, oper_dispatcher_GetProviders_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "OperFactoryTest-begin oper_dispatcher_GetProviders_0000";
+    LocalDirectoryUtils::SetRootDir("/data/local/tmp/fms");
+    auto providers = OperDispatcher::GetProviders();
+    ASSERT_EQ(providers.size(), Equipment::EQUIPMENT_BUTT);
+    EXPECT_EQ(providers[Equipment::EXTERNAL_STORAGE]->GetName(), EXTERNAL_STORAGE_NAME);
+    EXPECT_EQ(providers[Equipment::LOCAL_DIRECTORY]->GetId(), Equipment::LOCAL_DIRECTORY);
+    EXPECT_TRUE(providers[Equipment::LOCAL_DIRECTORY]->IsSupported(Operation::MAKE_DIR));
+    EXPECT_FALSE(providers[Equipment::LOCAL_DIRECTORY]->IsSupported(Operation::GET_FOLDER_STATS));
+    EXPECT_FALSE(providers[Equipment::EXTERNAL_STORAGE]->IsSupported(Operation::MAKE_DIR));
+    EXPECT_NE(OperDispatcher::GetFileOper(Equipment::LOCAL_DIRECTORY), nullptr);
+    EXPECT_EQ(OperDispatcher::GetFileOper(Equipment::EQUIPMENT_BUTT), nullptr);
+    GTEST_LOG_(INFO) << "OperFactoryTest-end oper_dispatcher_GetProviders_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_oper_dispatcher_GetProviders_0001
+ * @tc.name: oper_dispatcher_GetProviders_0001
+ * @tc.desc: Test function of GetProviders interface which leaves out the local directory provider without a root.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(OperFactoryTest, oper_dispatcher_GetProviders_0001, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "OperFactoryTest-begin oper_dispatcher_GetProviders_0001";
+    LocalDirectoryUtils::SetRootDir("");
+    auto providers = OperDispatcher::GetProviders();
+    ASSERT_EQ(providers.size(), Equipment::EQUIPMENT_BUTT - 1);
+    for (const auto &provider : providers) {
+        EXPECT_NE(provider->GetId(), Equipment::LOCAL_DIRECTORY);
+    }
+    EXPECT_EQ(OperDispatcher::GetFileOper(Equipment::LOCAL_DIRECTORY), nullptr);
+    EXPECT_EQ(OperDispatcher::GetHandler(Equipment::LOCAL_DIRECTORY, Operation::MAKE_DIR), nullptr);
+    MessageParcel data;
+    MessageParcel reply;
+    EXPECT_EQ(OperDispatcher::Dispatch(Equipment::LOCAL_DIRECTORY, Operation::MAKE_DIR, 0, data, reply),
+        E_INVALID_OPERCODE);
+    GTEST_LOG_(INFO) << "OperFactoryTest-end oper_dispatcher_GetProviders_0001";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_oper_dispatcher_Dispatch_0000
+ * @tc.name: oper_dispatcher_Dispatch_0000
+ * @tc.desc: Test function of Dispatch interface for FAIL which CREATE_FILES has more names than MAX_BATCH_NUM.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(OperFactoryTest, oper_dispatcher_Dispatch_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "OperFactoryTest-begin oper_dispatcher_Dispatch_0000";
+    MessageParcel data;
+    data.WriteStringVector(vector<string>(MAX_BATCH_NUM + 1, "oper_dispatcher_Dispatch_0000.txt"));
+    data.WriteString(FISRT_LEVEL_ALBUM);
+    MessageParcel reply;
+    EXPECT_EQ(OperDispatcher::Dispatch(Equipment::INTERNAL_STORAGE, Operation::CREATE_FILES, 0, data, reply),
+        E_INVALID_FILE_NUMBER);
+    sptr<CmdResponse> cmdResponse = reply.ReadParcelable<CmdResponse>();
+    ASSERT_NE(cmdResponse, nullptr);
+    EXPECT_EQ(cmdResponse->GetErr(), E_INVALID_FILE_NUMBER);
+    GTEST_LOG_(INFO) << "OperFactoryTest-end oper_dispatcher_Dispatch_0000";
+}
 } // namespace
\ No newline at end of file
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "change_notifier.h"
+#include "file_manager_service_errno.h"
+
+namespace {
+using namespace std;
+using namespace OHOS;
+using namespace FileManagerService;
+constexpr uint32_t TEST_TOKEN_ID = 1;
+constexpr uint32_t OTHER_TOKEN_ID = 2;
+class ChangeNotifierTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "ChangeNotifierTest code test" << endl;
+    }
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown()
+    {
+        for (auto &object : objects_) {
+            ChangeNotifier::GetInstance().Remove(object);
+        }
+        objects_.clear();
+    };
+    sptr<IRemoteObject> NewObserver()
+    {
+        sptr<FmsObserverStub> observer = new FmsObserverStub([](int32_t, const string &) {});
+        objects_.push_back(observer->AsObject());
+        return objects_.back();
+    }
+    vector<sptr<IRemoteObject>> objects_;
+};
+
+/**
+ * @tc.number: SUB_STORAGE_change_notifier_Register_0000
+ * @tc.name: change_notifier_Register_0000
+ * @tc.desc: Test function of Register interface, a caller holds at most MAX_OBSERVER_NUM_PER_CALLER observers
+ *           and the others still register.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(ChangeNotifierTest, change_notifier_Register_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ChangeNotifierTest-begin change_notifier_Register_0000";
+    ChangeNotifier &notifier = ChangeNotifier::GetInstance();
+    for (size_t i = 0; i < MAX_OBSERVER_NUM_PER_CALLER; i++) {
+        EXPECT_EQ(notifier.Register(NewObserver(), TEST_TOKEN_ID), SUCCESS);
+    }
+    // an observer registered again takes no new slot
+    EXPECT_EQ(notifier.Register(objects_.front(), TEST_TOKEN_ID), SUCCESS);
+    EXPECT_EQ(notifier.Register(NewObserver(), TEST_TOKEN_ID), FAIL);
+    EXPECT_EQ(notifier.Register(NewObserver(), OTHER_TOKEN_ID), SUCCESS);
+    EXPECT_EQ(notifier.Size(), MAX_OBSERVER_NUM_PER_CALLER + 1);
+    GTEST_LOG_(INFO) << "ChangeNotifierTest-end change_notifier_Register_0000";
+}
+} // namespace
@@ -14,7 +14,9 @@
  */
 
 #include <cstdio>
+#include <cstdlib>
 #include <gtest/gtest.h>
+#include <sys/stat.h>
 
 #include "ifms_client.h"
 #include "file_info.h"
@@ -24,11 +26,26 @@
 #include "file_manager_service_def.h"
 #include "abs_shared_result_set.h"
 #include "file_manager_service.h"
+#include "file_manager_service_errno.h"
+#include "local_directory_utils.h"
+#include "rate_limiter.h"
 
 namespace {
 using namespace std;
 using namespace OHOS;
 using namespace FileManagerService;
+// wrap one sub request of BATCH as code, size and raw args
+static void WriteSubRequest(MessageParcel &data, uint32_t code, const vector<string> &args)
+{
+    MessageParcel subData;
+    for (auto &arg : args) {
+        subData.WriteString(arg);
+    }
+    data.WriteUint32(code);
+    data.WriteUint32(subData.GetDataSize());
+    data.WriteBuffer(reinterpret_cast<const void *>(subData.GetData()), subData.GetDataSize());
+}
+
 class FileManagerServiceTest : public testing::Test {
 public:
     static void SetUpTestCase(void)
@@ -108,4 +125,98 @@ HWTEST_F(FileManagerServiceTest, Ffile_Manager_Service_OnStop_0000, testing::ext
     }
     GTEST_LOG_(INFO) << "FileManagerServiceTest-end file_Manager_Service_OnStop_0000";
 }
-} // namespace
\ No newline at end of file
+
+/**
+ * @tc.number: SUB_STORAGE_file_Manager_Service_Batch_0000
+ * @tc.name: file_Manager_Service_Batch_0000
+ * @tc.desc: Test function of BATCH which has an invalid sub request in the middle, the ones after it still run.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(FileManagerServiceTest, file_Manager_Service_Batch_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FileManagerServiceTest-begin file_Manager_Service_Batch_0000";
+    char rootDir[] = "/tmp/fms_batch_XXXXXX";
+    ASSERT_NE(mkdtemp(rootDir), nullptr);
+    LocalDirectoryUtils::SetRootDir(rootDir);
+    string uri = LOCAL_DIRECTORY_URI + rootDir;
+    uint32_t localDirectory = static_cast<uint32_t>(Equipment::LOCAL_DIRECTORY) << EQUIPMENT_SHIFT;
+    uint32_t externalStorage = static_cast<uint32_t>(Equipment::EXTERNAL_STORAGE) << EQUIPMENT_SHIFT;
+    MessageParcel data;
+    data.WriteBool(false);
+    data.WriteUint32(4);
+    WriteSubRequest(data, localDirectory | Operation::MAKE_DIR, { "a", uri });
+    // external storage has no MAKE_DIR handler, and BATCH does not nest
+    WriteSubRequest(data, externalStorage | Operation::MAKE_DIR, { "b", uri });
+    WriteSubRequest(data, Operation::BATCH, { "c", uri });
+    WriteSubRequest(data, localDirectory | Operation::MAKE_DIR, { "d", uri });
+    MessageParcel reply;
+    sptr<FileManagerServiceStub> stub = new FileManagerServiceStub();
+    EXPECT_EQ(stub->OperProcess(Operation::BATCH, 0, data, reply), SUCCESS);
+    ASSERT_EQ(reply.ReadUint32(), 4u);
+    vector<int32_t> errs;
+    for (int i = 0; i < 4; i++) {
+        errs.push_back(reply.ReadInt32());
+        uint32_t size = reply.ReadUint32();
+        if (size > 0) {
+            reply.ReadBuffer(size);
+        }
+    }
+    EXPECT_EQ(errs, vector<int32_t>({ SUCCESS, E_INVALID_OPERCODE, E_INVALID_OPERCODE, SUCCESS }));
+    struct stat st;
+    EXPECT_EQ(stat((string(rootDir) + "/a").c_str(), &st), 0);
+    EXPECT_NE(stat((string(rootDir) + "/b").c_str(), &st), 0);
+    EXPECT_NE(stat((string(rootDir) + "/c").c_str(), &st), 0);
+    EXPECT_EQ(stat((string(rootDir) + "/d").c_str(), &st), 0);
+    string cmd = string("rm -rf ") + rootDir;
+    system(cmd.c_str());
+    GTEST_LOG_(INFO) << "FileManagerServiceTest-end file_Manager_Service_Batch_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_file_Manager_Service_Batch_0001
+ * @tc.name: file_Manager_Service_Batch_0001
+ * @tc.desc: Test function of BATCH which has more sub requests than the rate of the caller, each sub request is
+ *           charged to its own rate class.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(FileManagerServiceTest, file_Manager_Service_Batch_0001, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FileManagerServiceTest-begin file_Manager_Service_Batch_0001";
+    char rootDir[] = "/tmp/fms_batch_XXXXXX";
+    ASSERT_NE(mkdtemp(rootDir), nullptr);
+    LocalDirectoryUtils::SetRootDir(rootDir);
+    string uri = LOCAL_DIRECTORY_URI + rootDir;
+    uint32_t localDirectory = static_cast<uint32_t>(Equipment::LOCAL_DIRECTORY) << EQUIPMENT_SHIFT;
+    RateLimiter::GetInstance().SetLimit(RATE_WRITE, 1, 1);
+    MessageParcel data;
+    data.WriteBool(false);
+    data.WriteUint32(2);
+    WriteSubRequest(data, localDirectory | Operation::MAKE_DIR, { "a", uri });
+    WriteSubRequest(data, localDirectory | Operation::MAKE_DIR, { "b", uri });
+    MessageParcel reply;
+    sptr<FileManagerServiceStub> stub = new FileManagerServiceStub();
+    EXPECT_EQ(stub->OperProcess(Operation::BATCH, 0, data, reply), SUCCESS);
+    RateLimiter::GetInstance().SetLimit(RATE_WRITE, RATE_LIMIT_WRITE_RATE, RATE_LIMIT_WRITE_BURST);
+    ASSERT_EQ(reply.ReadUint32(), 2u);
+    vector<int32_t> errs;
+    for (int i = 0; i < 2; i++) {
+        errs.push_back(reply.ReadInt32());
+        uint32_t size = reply.ReadUint32();
+        if (size > 0) {
+            reply.ReadBuffer(size);
+        }
+    }
+    EXPECT_EQ(errs, vector<int32_t>({ SUCCESS, E_RATE_LIMITED }));
+    struct stat st;
+    EXPECT_NE(stat((string(rootDir) + "/b").c_str(), &st), 0);
+    string cmd = string("rm -rf ") + rootDir;
+    system(cmd.c_str());
+    GTEST_LOG_(INFO) << "FileManagerServiceTest-end file_Manager_Service_Batch_0001";
+}
+} // namespace
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstdio>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "file_manager_service_errno.h"
+#include "fms_metrics.h"
+
+namespace {
+using namespace std;
+using namespace OHOS;
+using namespace FileManagerService;
+constexpr int64_t FAST_COST_US = 100;
+constexpr int64_t FAST_BUCKET_BOUND_US = 128;
+constexpr int FAST_REQUEST_NUM = 99;
+class FmsMetricsTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "FmsMetricsTest code test" << endl;
+    }
+    static void TearDownTestCase() {};
+    void SetUp()
+    {
+        FmsMetrics::GetInstance().Reset();
+    };
+    void TearDown() {};
+};
+
+/**
+ * @tc.number: SUB_STORAGE_fms_metrics_RedactPath_0000
+ * @tc.name: fms_metrics_RedactPath_0000
+ * @tc.desc: Test function of RedactPath interface, only the first segment of the path is kept.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(FmsMetricsTest, fms_metrics_RedactPath_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsMetricsTest-begin fms_metrics_RedactPath_0000";
+    EXPECT_EQ(FmsMetrics::RedactPath("dataability:///album/12/Secret"), "dataability:///album/*/*");
+    EXPECT_EQ(FmsMetrics::RedactPath("dataability:///external_storage/mnt/sdcard/a.txt"),
+        "dataability:///external_storage/*/*/*");
+    EXPECT_EQ(FmsMetrics::RedactPath("dataability:///album"), "dataability:///album");
+    EXPECT_EQ(FmsMetrics::RedactPath(""), "");
+    GTEST_LOG_(INFO) << "FmsMetricsTest-end fms_metrics_RedactPath_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_fms_metrics_GetPercentile_0000
+ * @tc.name: fms_metrics_GetPercentile_0000
+ * @tc.desc: Test function of GetPercentile interface, the bucket bound of the rank is returned.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(FmsMetricsTest, fms_metrics_GetPercentile_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsMetricsTest-begin fms_metrics_GetPercentile_0000";
+    array<uint64_t, LATENCY_BUCKET_NUM> buckets {};
+    EXPECT_EQ(FmsMetrics::GetPercentile(buckets, 50), 0);
+    buckets[FmsMetrics::GetBucket(FAST_COST_US)] = FAST_REQUEST_NUM;
+    buckets[FmsMetrics::GetBucket(SLOW_REQUEST_US)] = 1;
+    EXPECT_EQ(FmsMetrics::GetPercentile(buckets, 50), FAST_BUCKET_BOUND_US);
+    EXPECT_EQ(FmsMetrics::GetPercentile(buckets, 99), FAST_BUCKET_BOUND_US);
+    EXPECT_GT(FmsMetrics::GetPercentile(buckets, 100), SLOW_REQUEST_US);
+    GTEST_LOG_(INFO) << "FmsMetricsTest-end fms_metrics_GetPercentile_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_fms_metrics_Dump_0000
+ * @tc.name: fms_metrics_Dump_0000
+ * @tc.desc: Test function of Dump interface, counters and redacted slow requests are reported.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(FmsMetricsTest, fms_metrics_Dump_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FmsMetricsTest-begin fms_metrics_Dump_0000";
+    FmsMetrics &metrics = FmsMetrics::GetInstance();
+    bool pathRead = false;
+    metrics.RecordRequest(INTERNAL_STORAGE, LIST_FILE, SUCCESS, FAST_COST_US, [&pathRead] {
+        pathRead = true;
+        return string("dataability:///album/1");
+    });
+    EXPECT_FALSE(pathRead);
+    metrics.RecordRequest(EXTERNAL_STORAGE, LIST_FILE, FAIL, SLOW_REQUEST_US, [] {
+        return string("dataability:///external_storage/mnt/sdcard/Private");
+    });
+    metrics.RecordCache(CACHE_ALBUM_PATH, true);
+    metrics.RecordCache(CACHE_ALBUM_PATH, false);
+    string out;
+    metrics.Dump(out);
+    EXPECT_NE(out.find("LIST_FILE internal: count 1, errors 0"), string::npos);
+    EXPECT_NE(out.find("LIST_FILE external: count 1, errors 1"), string::npos);
+    EXPECT_NE(out.find("album_path: hit 1, miss 1, hit rate 50%"), string::npos);
+    EXPECT_NE(out.find("dataability:///external_storage/*/*/*"), string::npos);
+    EXPECT_EQ(out.find("Private"), string::npos);
+    GTEST_LOG_(INFO) << "FmsMetricsTest-end fms_metrics_Dump_0000";
+}
+} // namespace
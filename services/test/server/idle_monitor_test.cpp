@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <gtest/gtest.h>
+
+#include "idle_monitor.h"
+
+namespace {
+using namespace std;
+using namespace OHOS;
+using namespace FileManagerService;
+// long enough for the monitor thread to never fire, the tests drive CheckIdle with their own time
+constexpr int32_t IDLE_MS = 3600000;
+class IdleMonitorTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "IdleMonitorTest code test" << endl;
+    }
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown()
+    {
+        IdleMonitor::GetInstance().Stop();
+    };
+};
+
+/**
+ * @tc.number: SUB_STORAGE_idle_monitor_Start_0000
+ * @tc.name: idle_monitor_Start_0000
+ * @tc.desc: Test function of Start interface, onIdle runs once after the idle time and stops the monitor.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(IdleMonitorTest, idle_monitor_Start_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "IdleMonitorTest-begin idle_monitor_Start_0000";
+    atomic<int> idleNum(0);
+    auto begin = chrono::steady_clock::now();
+    IdleMonitor::GetInstance().Start(IDLE_MS, [&idleNum] {
+        idleNum++;
+        return true;
+    });
+    EXPECT_FALSE(IdleMonitor::GetInstance().CheckIdle(begin + chrono::milliseconds(IDLE_MS - 1)));
+    EXPECT_EQ(idleNum.load(), 0);
+    EXPECT_TRUE(IdleMonitor::GetInstance().CheckIdle(chrono::steady_clock::now() + chrono::milliseconds(IDLE_MS)));
+    EXPECT_EQ(idleNum.load(), 1);
+    EXPECT_FALSE(IdleMonitor::GetInstance().CheckIdle(chrono::steady_clock::now() + chrono::milliseconds(IDLE_MS)));
+    EXPECT_EQ(idleNum.load(), 1);
+    GTEST_LOG_(INFO) << "IdleMonitorTest-end idle_monitor_Start_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_idle_monitor_Start_0001
+ * @tc.name: idle_monitor_Start_0001
+ * @tc.desc: Test function of Start interface, a request in flight keeps the service from going idle.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(IdleMonitorTest, idle_monitor_Start_0001, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "IdleMonitorTest-begin idle_monitor_Start_0001";
+    atomic<int> idleNum(0);
+    IdleMonitor::GetInstance().Start(IDLE_MS, [&idleNum] {
+        idleNum++;
+        return true;
+    });
+    {
+        IdleGuard guard;
+        EXPECT_EQ(IdleMonitor::GetInstance().GetInflightNum(), 1u);
+        EXPECT_FALSE(IdleMonitor::GetInstance().CheckIdle(chrono::steady_clock::now() +
+            chrono::milliseconds(IDLE_MS)));
+        EXPECT_EQ(idleNum.load(), 0);
+    }
+    EXPECT_EQ(IdleMonitor::GetInstance().GetInflightNum(), 0u);
+    EXPECT_TRUE(IdleMonitor::GetInstance().CheckIdle(chrono::steady_clock::now() + chrono::milliseconds(IDLE_MS)));
+    EXPECT_EQ(idleNum.load(), 1);
+    GTEST_LOG_(INFO) << "IdleMonitorTest-end idle_monitor_Start_0001";
+}
+} // namespace
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <gtest/gtest.h>
+
+// the release setting of BUILD.gn, debug logs are compiled out
+#undef FMS_LOG_MIN_LEVEL
+#define FMS_LOG_MIN_LEVEL LOG_INFO
+#include "log.h"
+
+namespace {
+using namespace std;
+constexpr int LOG_LOOP_NUM = 1000;
+constexpr int LOG_BENCH_NUM = 100000;
+constexpr size_t LOG_BUFFER_SIZE = 64;
+int g_evalNum = 0;
+
+const char *CountedArg()
+{
+    g_evalNum++;
+    return "arg";
+}
+
+class LogLevelTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "LogLevelTest code test" << endl;
+    }
+    static void TearDownTestCase() {};
+    void SetUp()
+    {
+        g_evalNum = 0;
+    };
+    void TearDown() {};
+};
+
+/**
+ * @tc.number: SUB_STORAGE_log_level_DEBUG_LOG_0000
+ * @tc.name: log_level_DEBUG_LOG_0000
+ * @tc.desc: Test the arguments of a log below FMS_LOG_MIN_LEVEL are never evaluated.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(LogLevelTest, log_level_DEBUG_LOG_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "LogLevelTest-begin log_level_DEBUG_LOG_0000";
+    DEBUG_LOG("debug %{public}s", CountedArg());
+    EXPECT_EQ(g_evalNum, 0);
+    EXPECT_FALSE(FMS_LOG_ENABLED(LOG_DEBUG));
+    if (FMS_LOG_ENABLED(LOG_ERROR)) {
+        ERR_LOG("error %{public}s", CountedArg());
+        EXPECT_EQ(g_evalNum, 1);
+    }
+    GTEST_LOG_(INFO) << "LogLevelTest-end log_level_DEBUG_LOG_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_log_level_DEBUG_LOG_0001
+ * @tc.name: log_level_DEBUG_LOG_0001
+ * @tc.desc: Test the gate of every level, a level below FMS_LOG_MIN_LEVEL stays off in a loop and a level
+ *           at or above it evaluates its arguments exactly when it is enabled at runtime.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(LogLevelTest, log_level_DEBUG_LOG_0001, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "LogLevelTest-begin log_level_DEBUG_LOG_0001";
+    static_assert(LOG_DEBUG < FMS_LOG_MIN_LEVEL, "debug logs are compiled out");
+    for (int i = 0; i < LOG_LOOP_NUM; i++) {
+        DEBUG_LOG("entry %{public}s", CountedArg());
+    }
+    EXPECT_EQ(g_evalNum, 0);
+
+    int expectNum = 0;
+    INFO_LOG("info %{public}s", CountedArg());
+    expectNum += FMS_LOG_ENABLED(LOG_INFO) ? 1 : 0;
+    WARNING_LOG("warning %{public}s", CountedArg());
+    expectNum += FMS_LOG_ENABLED(LOG_WARN) ? 1 : 0;
+    ERR_LOG("error %{public}s", CountedArg());
+    expectNum += FMS_LOG_ENABLED(LOG_ERROR) ? 1 : 0;
+    EXPECT_EQ(g_evalNum, expectNum);
+    GTEST_LOG_(INFO) << "LogLevelTest-end log_level_DEBUG_LOG_0001";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_log_level_DEBUG_LOG_0002
+ * @tc.name: log_level_DEBUG_LOG_0002
+ * @tc.desc: Measure a compiled out log in a loop against formatting its arguments, the costs are logged only,
+ *           wall clock on a shared machine is no pass criterion.
+ * @tc.size: MEDIUM
+ * @tc.type: PERF
+ * @tc.level Level 3
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(LogLevelTest, log_level_DEBUG_LOG_0002, testing::ext::TestSize.Level3)
+{
+    GTEST_LOG_(INFO) << "LogLevelTest-begin log_level_DEBUG_LOG_0002";
+    auto begin = chrono::steady_clock::now();
+    for (int i = 0; i < LOG_BENCH_NUM; i++) {
+        DEBUG_LOG("entry %{public}s", to_string(i).c_str());
+    }
+    auto gatedCost = chrono::steady_clock::now() - begin;
+    char buffer[LOG_BUFFER_SIZE];
+    size_t written = 0;
+    begin = chrono::steady_clock::now();
+    for (int i = 0; i < LOG_BENCH_NUM; i++) {
+        // what every call paid before the gate: build the arguments and format them
+        int ret = snprintf(buffer, sizeof(buffer), "{%s():%d} entry %s", __FUNCTION__, __LINE__,
+            to_string(i).c_str());
+        written += (ret > 0) ? ret : 0;
+    }
+    auto formatCost = chrono::steady_clock::now() - begin;
+    GTEST_LOG_(INFO) << "gated " << chrono::duration_cast<chrono::microseconds>(gatedCost).count() <<
+        " us, formatted " << chrono::duration_cast<chrono::microseconds>(formatCost).count() << " us for " <<
+        LOG_BENCH_NUM << " logs, " << written << " bytes";
+    GTEST_LOG_(INFO) << "LogLevelTest-end log_level_DEBUG_LOG_0002";
+}
+} // namespace
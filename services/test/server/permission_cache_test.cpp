@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <gtest/gtest.h>
+
+#include "permission_cache.h"
+
+namespace {
+using namespace std;
+using namespace OHOS;
+using namespace FileManagerService;
+using namespace Security::AccessToken;
+constexpr AccessTokenID TEST_TOKEN_ID = 1;
+constexpr AccessTokenID OTHER_TOKEN_ID = 2;
+const string TEST_PERMISSION = "ohos.permission.READ_MEDIA";
+class PermissionCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "PermissionCacheTest code test" << endl;
+    }
+    static void TearDownTestCase()
+    {
+        PermissionCache::GetInstance().SetVerifier(nullptr);
+    };
+    void SetUp()
+    {
+        verifyCount_ = 0;
+        PermissionCache::GetInstance().SetVerifier([this](AccessTokenID tokenId, const string &permission) {
+            verifyCount_++;
+            return tokenId == TEST_TOKEN_ID;
+        });
+    };
+    void TearDown() {};
+    int verifyCount_ {0};
+};
+
+/**
+ * @tc.number: SUB_STORAGE_permission_cache_VerifyPermission_0000
+ * @tc.name: permission_cache_VerifyPermission_0000
+ * @tc.desc: Test function of VerifyPermission interface, a cached decision is replied without verifying again.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(PermissionCacheTest, permission_cache_VerifyPermission_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "PermissionCacheTest-begin permission_cache_VerifyPermission_0000";
+    PermissionCache &cache = PermissionCache::GetInstance();
+    auto now = chrono::steady_clock::now();
+    EXPECT_TRUE(cache.VerifyPermission(TEST_TOKEN_ID, TEST_PERMISSION, now));
+    EXPECT_TRUE(cache.VerifyPermission(TEST_TOKEN_ID, TEST_PERMISSION, now));
+    EXPECT_FALSE(cache.VerifyPermission(OTHER_TOKEN_ID, TEST_PERMISSION, now));
+    EXPECT_FALSE(cache.VerifyPermission(OTHER_TOKEN_ID, TEST_PERMISSION, now));
+    EXPECT_EQ(verifyCount_, 2);
+    EXPECT_EQ(cache.Size(), 2u);
+    GTEST_LOG_(INFO) << "PermissionCacheTest-end permission_cache_VerifyPermission_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_permission_cache_VerifyPermission_0001
+ * @tc.name: permission_cache_VerifyPermission_0001
+ * @tc.desc: Test function of VerifyPermission interface, a decision is verified again after the ttl.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(PermissionCacheTest, permission_cache_VerifyPermission_0001, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "PermissionCacheTest-begin permission_cache_VerifyPermission_0001";
+    PermissionCache &cache = PermissionCache::GetInstance();
+    auto now = chrono::steady_clock::now();
+    EXPECT_TRUE(cache.VerifyPermission(TEST_TOKEN_ID, TEST_PERMISSION, now));
+    now += chrono::milliseconds(PERMISSION_CACHE_TTL_MS - 1);
+    EXPECT_TRUE(cache.VerifyPermission(TEST_TOKEN_ID, TEST_PERMISSION, now));
+    EXPECT_EQ(verifyCount_, 1);
+    now += chrono::milliseconds(1);
+    EXPECT_TRUE(cache.VerifyPermission(TEST_TOKEN_ID, TEST_PERMISSION, now));
+    EXPECT_EQ(verifyCount_, 2);
+    GTEST_LOG_(INFO) << "PermissionCacheTest-end permission_cache_VerifyPermission_0001";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_permission_cache_Invalidate_0000
+ * @tc.name: permission_cache_Invalidate_0000
+ * @tc.desc: Test function of Invalidate interface, a permission state change drops the decisions of the token.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(PermissionCacheTest, permission_cache_Invalidate_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "PermissionCacheTest-begin permission_cache_Invalidate_0000";
+    PermissionCache &cache = PermissionCache::GetInstance();
+    auto now = chrono::steady_clock::now();
+    EXPECT_TRUE(cache.VerifyPermission(TEST_TOKEN_ID, TEST_PERMISSION, now));
+    EXPECT_FALSE(cache.VerifyPermission(OTHER_TOKEN_ID, TEST_PERMISSION, now));
+    PermStateChangeScope scope;
+    PermissionChangeCallback callback(scope);
+    PermStateChangeInfo info;
+    info.tokenID = TEST_TOKEN_ID;
+    info.permissionName = TEST_PERMISSION;
+    callback.PermStateChangeCallback(info);
+    EXPECT_EQ(cache.Size(), 1u);
+    EXPECT_TRUE(cache.VerifyPermission(TEST_TOKEN_ID, TEST_PERMISSION, now));
+    EXPECT_FALSE(cache.VerifyPermission(OTHER_TOKEN_ID, TEST_PERMISSION, now));
+    EXPECT_EQ(verifyCount_, 3);
+    GTEST_LOG_(INFO) << "PermissionCacheTest-end permission_cache_Invalidate_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_permission_cache_Invalidate_0001
+ * @tc.name: permission_cache_Invalidate_0001
+ * @tc.desc: Test function of Invalidate interface, a permission state change during the verify keeps the
+ *           decision out of the cache.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(PermissionCacheTest, permission_cache_Invalidate_0001, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "PermissionCacheTest-begin permission_cache_Invalidate_0001";
+    PermissionCache &cache = PermissionCache::GetInstance();
+    cache.SetVerifier([this](AccessTokenID tokenId, const string &permission) {
+        verifyCount_++;
+        PermissionCache::GetInstance().Invalidate(tokenId);
+        return true;
+    });
+    auto now = chrono::steady_clock::now();
+    EXPECT_TRUE(cache.VerifyPermission(TEST_TOKEN_ID, TEST_PERMISSION, now));
+    EXPECT_EQ(cache.Size(), 0u);
+    EXPECT_TRUE(cache.VerifyPermission(TEST_TOKEN_ID, TEST_PERMISSION, now));
+    EXPECT_EQ(verifyCount_, 2);
+    GTEST_LOG_(INFO) << "PermissionCacheTest-end permission_cache_Invalidate_0001";
+}
+} // namespace
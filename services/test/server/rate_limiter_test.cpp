@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <gtest/gtest.h>
+
+#include "file_manager_service_def.h"
+#include "rate_limiter.h"
+
+namespace {
+using namespace std;
+using namespace OHOS;
+using namespace FileManagerService;
+constexpr uint32_t TEST_TOKEN_ID = 1;
+constexpr uint32_t OTHER_TOKEN_ID = 2;
+constexpr uint32_t TEST_RATE = 10;
+constexpr uint32_t TEST_BURST = 3;
+constexpr int REFILL_ONE_MS = 100;
+class RateLimiterTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "RateLimiterTest code test" << endl;
+    }
+    static void TearDownTestCase()
+    {
+        RateLimiter::GetInstance().SetLimit(RATE_READ, RATE_LIMIT_READ_RATE, RATE_LIMIT_READ_BURST);
+    };
+    void SetUp()
+    {
+        RateLimiter::GetInstance().SetLimit(RATE_READ, TEST_RATE, TEST_BURST);
+    };
+    void TearDown() {};
+};
+
+/**
+ * @tc.number: SUB_STORAGE_rate_limiter_TryAcquire_0000
+ * @tc.name: rate_limiter_TryAcquire_0000
+ * @tc.desc: Test function of TryAcquire interface, a caller gets burst requests and then one per refill.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(RateLimiterTest, rate_limiter_TryAcquire_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "RateLimiterTest-begin rate_limiter_TryAcquire_0000";
+    RateLimiter &limiter = RateLimiter::GetInstance();
+    auto now = chrono::steady_clock::now();
+    for (uint32_t i = 0; i < TEST_BURST; i++) {
+        EXPECT_TRUE(limiter.TryAcquire(RATE_READ, TEST_TOKEN_ID, now));
+    }
+    EXPECT_FALSE(limiter.TryAcquire(RATE_READ, TEST_TOKEN_ID, now));
+    // other callers have their own bucket
+    EXPECT_TRUE(limiter.TryAcquire(RATE_READ, OTHER_TOKEN_ID, now));
+    now += chrono::milliseconds(REFILL_ONE_MS);
+    EXPECT_TRUE(limiter.TryAcquire(RATE_READ, TEST_TOKEN_ID, now));
+    EXPECT_FALSE(limiter.TryAcquire(RATE_READ, TEST_TOKEN_ID, now));
+    GTEST_LOG_(INFO) << "RateLimiterTest-end rate_limiter_TryAcquire_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_rate_limiter_TryAcquire_0001
+ * @tc.name: rate_limiter_TryAcquire_0001
+ * @tc.desc: Test function of TryAcquire interface, a rate of 0 never limits.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(RateLimiterTest, rate_limiter_TryAcquire_0001, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "RateLimiterTest-begin rate_limiter_TryAcquire_0001";
+    RateLimiter &limiter = RateLimiter::GetInstance();
+    limiter.SetLimit(RATE_READ, 0, TEST_BURST);
+    auto now = chrono::steady_clock::now();
+    for (uint32_t i = 0; i < TEST_BURST * TEST_BURST; i++) {
+        EXPECT_TRUE(limiter.TryAcquire(RATE_READ, TEST_TOKEN_ID, now));
+    }
+    EXPECT_EQ(limiter.Size(), 0u);
+    GTEST_LOG_(INFO) << "RateLimiterTest-end rate_limiter_TryAcquire_0001";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_rate_limiter_GetRateClass_0000
+ * @tc.name: rate_limiter_GetRateClass_0000
+ * @tc.desc: Test function of GetRateClass interface.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(RateLimiterTest, rate_limiter_GetRateClass_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "RateLimiterTest-begin rate_limiter_GetRateClass_0000";
+    EXPECT_EQ(RateLimiter::GetRateClass(Operation::LIST_FILE), RATE_READ);
+    EXPECT_EQ(RateLimiter::GetRateClass(Operation::CREATE_FILE), RATE_WRITE);
+    EXPECT_EQ(RateLimiter::GetRateClass(Operation::BATCH), RATE_BULK);
+    GTEST_LOG_(INFO) << "RateLimiterTest-end rate_limiter_GetRateClass_0000";
+}
+} // namespace
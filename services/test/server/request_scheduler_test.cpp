@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "file_manager_service_def.h"
+#include "file_manager_service_errno.h"
+#include "request_scheduler.h"
+
+namespace {
+using namespace std;
+using namespace OHOS;
+using namespace FileManagerService;
+constexpr uint32_t TEST_TOKEN_ID = 0;
+class RequestSchedulerTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "RequestSchedulerTest code test" << endl;
+    }
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+/**
+ * @tc.number: SUB_STORAGE_request_scheduler_GetPriority_0000
+ * @tc.name: request_scheduler_GetPriority_0000
+ * @tc.desc: Test function of GetPriority interface for opcode and async caller.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(RequestSchedulerTest, request_scheduler_GetPriority_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "RequestSchedulerTest-begin request_scheduler_GetPriority_0000";
+    EXPECT_EQ(RequestScheduler::GetPriority(Operation::LIST_FILE, TEST_TOKEN_ID, false), PRIORITY_FOREGROUND);
+    EXPECT_EQ(RequestScheduler::GetPriority(Operation::LIST_FILE, TEST_TOKEN_ID, true), PRIORITY_NORMAL);
+    EXPECT_EQ(RequestScheduler::GetPriority(Operation::CREATE_FILES, TEST_TOKEN_ID, false), PRIORITY_BACKGROUND);
+    GTEST_LOG_(INFO) << "RequestSchedulerTest-end request_scheduler_GetPriority_0000";
+}
+
+/**
+ * @tc.number: SUB_STORAGE_request_scheduler_Acquire_0000
+ * @tc.name: request_scheduler_Acquire_0000
+ * @tc.desc: Test function of Acquire interface, foreground is not blocked by queued background requests.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(RequestSchedulerTest, request_scheduler_Acquire_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "RequestSchedulerTest-begin request_scheduler_Acquire_0000";
+    RequestScheduler &scheduler = RequestScheduler::GetInstance();
+    for (int i = 0; i < SCHEDULER_MAX_BACKGROUND_RUNNING; i++) {
+        EXPECT_EQ(scheduler.Acquire(PRIORITY_BACKGROUND, TEST_TOKEN_ID), SUCCESS);
+    }
+    int queuedErr = FAIL;
+    thread queued([&scheduler, &queuedErr] {
+        queuedErr = scheduler.Acquire(PRIORITY_BACKGROUND, TEST_TOKEN_ID);
+    });
+    // the background slots are full, the request stays queued until one is released
+    while (scheduler.GetQueueDepth(PRIORITY_BACKGROUND) == 0) {
+        this_thread::yield();
+    }
+    EXPECT_EQ(scheduler.GetQueueDepth(PRIORITY_BACKGROUND), 1u);
+
+    EXPECT_EQ(scheduler.Acquire(PRIORITY_FOREGROUND, TEST_TOKEN_ID), SUCCESS);
+    scheduler.Release(PRIORITY_FOREGROUND);
+
+    scheduler.Release(PRIORITY_BACKGROUND);
+    queued.join();
+    EXPECT_EQ(queuedErr, SUCCESS);
+    EXPECT_EQ(scheduler.GetQueueDepth(PRIORITY_BACKGROUND), 0u);
+    for (int i = 0; i < SCHEDULER_MAX_BACKGROUND_RUNNING; i++) {
+        scheduler.Release(PRIORITY_BACKGROUND);
+    }
+    EXPECT_EQ(scheduler.GetRunningNum(), 0u);
+    GTEST_LOG_(INFO) << "RequestSchedulerTest-end request_scheduler_Acquire_0000";
+}
+} // namespace
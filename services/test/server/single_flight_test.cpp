@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "file_manager_service_errno.h"
+#include "single_flight.h"
+
+namespace {
+using namespace std;
+using namespace OHOS;
+using namespace FileManagerService;
+constexpr int FLIGHT_CALLER_NUM = 4;
+const string FLIGHT_KEY = "list|/mnt/sdcard|0|10";
+constexpr int32_t FLIGHT_RESULT = 42;
+class SingleFlightTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "SingleFlightTest code test" << endl;
+    }
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+/**
+ * @tc.number: SUB_STORAGE_single_flight_Do_0000
+ * @tc.name: single_flight_Do_0000
+ * @tc.desc: Test function of Do interface, concurrent calls of one key run once and all get the reply.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(SingleFlightTest, single_flight_Do_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SingleFlightTest-begin single_flight_Do_0000";
+    atomic<int> runs(0);
+    vector<int32_t> results(FLIGHT_CALLER_NUM, 0);
+    vector<thread> callers;
+    for (int i = 0; i < FLIGHT_CALLER_NUM; i++) {
+        callers.emplace_back([&runs, &results, i] {
+            Parcel reply;
+            int err = SingleFlight::GetInstance().Do(FLIGHT_KEY, reply, [&runs](Parcel &out) {
+                runs++;
+                // hold the run until every other caller joined it
+                while (SingleFlight::GetInstance().GetWaiterNum(FLIGHT_KEY) < FLIGHT_CALLER_NUM - 1) {
+                    this_thread::yield();
+                }
+                out.WriteInt32(FLIGHT_RESULT);
+                return SUCCESS;
+            });
+            if (err == SUCCESS) {
+                results[i] = reply.ReadInt32();
+            }
+        });
+    }
+    for (auto &caller : callers) {
+        caller.join();
+    }
+    EXPECT_EQ(runs, 1);
+    for (int32_t result : results) {
+        EXPECT_EQ(result, FLIGHT_RESULT);
+    }
+    EXPECT_EQ(SingleFlight::GetInstance().Size(), 0u);
+    GTEST_LOG_(INFO) << "SingleFlightTest-end single_flight_Do_0000";
+}
+} // namespace
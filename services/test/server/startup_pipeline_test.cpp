@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "startup_pipeline.h"
+
+namespace {
+using namespace std;
+using namespace OHOS;
+using namespace FileManagerService;
+constexpr int PHASE_RUN_MS = 20;
+class StartupPipelineTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        cout << "StartupPipelineTest code test" << endl;
+    }
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+/**
+ * @tc.number: SUB_STORAGE_startup_pipeline_Start_0000
+ * @tc.name: startup_pipeline_Start_0000
+ * @tc.desc: Test function of Start interface, phases run in order, a failed phase does not stop the rest.
+ * @tc.size: MEDIUM
+ * @tc.type: FUNC
+ * @tc.level Level 1
+ * @tc.require: AR000GJ9T3
+ */
+HWTEST_F(StartupPipelineTest, startup_pipeline_Start_0000, testing::ext::TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "StartupPipelineTest-begin startup_pipeline_Start_0000";
+    StartupPipeline pipeline;
+    vector<string> order;
+    pipeline.AddPhase("first", [&order] {
+        order.push_back("first");
+        this_thread::sleep_for(chrono::milliseconds(PHASE_RUN_MS));
+        return true;
+    });
+    pipeline.AddPhase("second", [&order] {
+        order.push_back("second");
+        return false;
+    });
+    pipeline.AddPhase("third", [&order] {
+        order.push_back("third");
+        return true;
+    });
+    pipeline.Start();
+    pipeline.Wait();
+    EXPECT_TRUE(pipeline.IsReady());
+    vector<string> expect = {"first", "second", "third"};
+    EXPECT_EQ(order, expect);
+    vector<PhaseResult> results = pipeline.GetResults();
+    ASSERT_EQ(results.size(), expect.size());
+    EXPECT_TRUE(results[0].succ);
+    EXPECT_GE(results[0].costUs, PHASE_RUN_MS * 1000);
+    EXPECT_FALSE(results[1].succ);
+    EXPECT_TRUE(results[2].succ);
+    GTEST_LOG_(INFO) << "StartupPipelineTest-end startup_pipeline_Start_0000";
+}
+} // namespace
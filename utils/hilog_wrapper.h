@@ -56,21 +56,25 @@ static constexpr OHOS::HiviewDFX::HiLogLabel LOG_LABEL = {LOG_CORE, AMS_LOG_DOMA
 
 #define __FILENAME__ (__builtin_strrchr(__FILE__, '/') ? __builtin_strrchr(__FILE__, '/') + 1 : __FILE__)
 
-#define HILOG_FATAL(fmt, ...)            \
-    (void)OHOS::HiviewDFX::HiLog::Fatal( \
-        LOG_LABEL, "[%{public}s(%{public}s:%{public}d)]" fmt, __FILENAME__, __FUNCTION__, __LINE__, ##__VA_ARGS__)
-#define HILOG_ERROR(fmt, ...)            \
-    (void)OHOS::HiviewDFX::HiLog::Error( \
-        LOG_LABEL, "[%{public}s(%{public}s:%{public}d)]" fmt, __FILENAME__, __FUNCTION__, __LINE__, ##__VA_ARGS__)
-#define HILOG_WARN(fmt, ...)            \
-    (void)OHOS::HiviewDFX::HiLog::Warn( \
-        LOG_LABEL, "[%{public}s(%{public}s:%{public}d)]" fmt, __FILENAME__, __FUNCTION__, __LINE__, ##__VA_ARGS__)
-#define HILOG_INFO(fmt, ...)            \
-    (void)OHOS::HiviewDFX::HiLog::Info( \
-        LOG_LABEL, "[%{public}s(%{public}s:%{public}d)]" fmt, __FILENAME__, __FUNCTION__, __LINE__, ##__VA_ARGS__)
-#define HILOG_DEBUG(fmt, ...)            \
-    (void)OHOS::HiviewDFX::HiLog::Debug( \
-        LOG_LABEL, "[%{public}s(%{public}s:%{public}d)]" fmt, __FILENAME__, __FUNCTION__, __LINE__, ##__VA_ARGS__)
+// levels below FAF_LOG_MIN_LEVEL are compiled out, the build sets it to LOG_INFO for release
+#ifndef FAF_LOG_MIN_LEVEL
+#define FAF_LOG_MIN_LEVEL LOG_DEBUG
+#endif
+
+// the arguments are only evaluated when the level is compiled in and enabled at runtime
+#define HILOG_PRINT(level, func, fmt, ...)                                                                    \
+    do {                                                                                                      \
+        if ((level) >= (FAF_LOG_MIN_LEVEL) && HiLogIsLoggable(AMS_LOG_DOMAIN, AMS_LOG_TAG, (level))) {       \
+            (void)OHOS::HiviewDFX::HiLog::func(LOG_LABEL, "[%{public}s(%{public}s:%{public}d)]" fmt,         \
+                __FILENAME__, __FUNCTION__, __LINE__, ##__VA_ARGS__);                                         \
+        }                                                                                                     \
+    } while (0)
+
+#define HILOG_FATAL(fmt, ...) HILOG_PRINT(LOG_FATAL, Fatal, fmt, ##__VA_ARGS__)
+#define HILOG_ERROR(fmt, ...) HILOG_PRINT(LOG_ERROR, Error, fmt, ##__VA_ARGS__)
+#define HILOG_WARN(fmt, ...) HILOG_PRINT(LOG_WARN, Warn, fmt, ##__VA_ARGS__)
+#define HILOG_INFO(fmt, ...) HILOG_PRINT(LOG_INFO, Info, fmt, ##__VA_ARGS__)
+#define HILOG_DEBUG(fmt, ...) HILOG_PRINT(LOG_DEBUG, Debug, fmt, ##__VA_ARGS__)
 #else
 
 #define HILOG_FATAL(...)